@@ -0,0 +1,357 @@
+/**
+* @file MatrixBenchmark.cpp
+ * @brief Benchmarks of the construction, copy, move, operations and printing of the matrices, built as matrix_bench.
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful timings, and filter with --benchmark_filter=<regex>.
+ * The operations are measured on square, skinny and mismatched shapes, for a small, a 16 bits and a 32 bits modulus.
+ * The bytes processed are the elements read and written once, the items processed the elements of the result. The
+ * products also report their cache misses, or the size of an operand relative to the last level cache.
+ * LABMATRIX_BENCH_LARGE=1 adds the products of operands beyond the last level cache, where the tiled layout matters.
+*/
+#include <benchmark/benchmark.h>
+#include "../src/Matrix/Matrix.hpp"
+#include "../src/TiledMatrix/TiledMatrix.hpp"
+#include "../src/Utils/Utils.h"
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// region Arguments
+
+static constexpr unsigned MODULI[] = {7, 65521, 4294967291u};
+
+/**
+ * @brief Adds the shapes of the operands of an operation between two matrices: {rows1, columns1, rows2, columns2,
+ * modulo}. The mismatched operands are padded by the operations.
+ */
+static void operationShapes(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"rows1", "cols1", "rows2", "cols2", "mod"});
+    for (int64_t modulo: MODULI) {
+        for (int64_t size: {64, 256, 1024}) {
+            benchmark->Args({size, size, size, size, modulo});                          // Square
+            benchmark->Args({size * size / 8, 8, size * size / 8, 8, modulo});          // Skinny
+            benchmark->Args({size, size, size / 2, size * 2, modulo});                  // Mismatched
+        }
+    }
+}
+
+/** @brief Adds the shapes of a single matrix: {rows, columns, modulo}. */
+static void matrixShapes(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"rows", "cols", "mod"});
+    for (int64_t modulo: MODULI) {
+        for (int64_t size: {64, 256, 1024}) {
+            benchmark->Args({size, size, modulo});
+            benchmark->Args({size * size / 8, 8, modulo});
+        }
+    }
+}
+
+/** @return The number of bytes of the elements of a matrix. */
+static int64_t matrixBytes(const Matrix &matrix) {
+    return int64_t(matrix.getRows()) * matrix.getColumns() * int64_t(sizeof(unsigned));
+}
+
+/** @brief Reports the bytes of the operands read and of the result written, and the elements of the result. */
+static void reportOperation(benchmark::State &state, const Matrix &one, const Matrix &two, const Matrix &result) {
+    const int64_t resultBytes = matrixBytes(result);
+    state.SetBytesProcessed(int64_t(state.iterations()) * (matrixBytes(one) + matrixBytes(two) + resultBytes));
+    state.SetItemsProcessed(int64_t(state.iterations()) * resultBytes / int64_t(sizeof(unsigned)));
+}
+
+/**
+ * @class CacheMissCounter
+ * @brief Counts the cache misses of the process (PERF_COUNT_HW_CACHE_MISSES, the last level cache on most CPUs),
+ * including the threads of the kernels, from its construction. The count is unavailable when the kernel or the
+ * container forbids the performance counters.
+ */
+class CacheMissCounter {
+private:
+    int descriptor = -1;
+
+public:
+    CacheMissCounter() {
+#ifdef __linux__
+        perf_event_attr attributes{};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+        attributes.inherit = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        descriptor = int(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter &) = delete;
+
+    CacheMissCounter &operator=(const CacheMissCounter &) = delete;
+
+    /** @return The number of cache misses since the construction, -1 if it is unavailable. */
+    [[nodiscard]] int64_t read() const {
+#ifdef __linux__
+        uint64_t count = 0;
+        if (descriptor >= 0 && ::read(descriptor, &count, sizeof(count)) == ssize_t(sizeof(count))) {
+            return int64_t(count);
+        }
+#endif
+        return -1;
+    }
+};
+
+/** @return The size in bytes of the largest cache of the highest level, 0 if unknown. */
+static int64_t lastLevelCacheBytes() {
+    int level = 0;
+    int64_t bytes = 0;
+    for (const auto &cache: benchmark::CPUInfo::Get().caches) {
+        if (cache.level > level || (cache.level == level && cache.size > bytes)) {
+            level = cache.level;
+            bytes = cache.size;
+        }
+    }
+    return bytes;
+}
+
+/**
+ * @brief Reports the cache misses per iteration when the performance counters are available, and the size of an
+ * operand relative to the last level cache, the proxy of the misses when they are not: beyond 1, the operands of a
+ * product are read from memory.
+ */
+static void reportCache(benchmark::State &state, const CacheMissCounter &misses, const Matrix &operand) {
+    const int64_t count = misses.read();
+    if (count >= 0) {
+        state.counters["cache_misses"] = benchmark::Counter(double(count), benchmark::Counter::kAvgIterations);
+    }
+    const int64_t cacheBytes = lastLevelCacheBytes();
+    if (cacheBytes > 0) {
+        state.counters["operand_per_llc"] = double(matrixBytes(operand)) / double(cacheBytes);
+    }
+}
+
+/** @return The first operand of the state arguments. */
+static Matrix firstOperand(const benchmark::State &state) {
+    return {unsigned(state.range(0)), unsigned(state.range(1)), unsigned(state.range(4))};
+}
+
+/** @return The second operand of the state arguments. */
+static Matrix secondOperand(const benchmark::State &state) {
+    return {unsigned(state.range(2)), unsigned(state.range(3)), unsigned(state.range(4))};
+}
+
+/**
+ * @brief Times an in-place operation on the operands of the state arguments. A second operand larger than the first
+ * one pads the first one to its shape, so the first operand is restored outside of the timed region before each run:
+ * every run then operates on the mismatched shapes, in place of the same shape after the first run.
+ * @param operation The operation, applied in-place to its first argument.
+ */
+template<typename Operation>
+static void benchmarkInPlace(benchmark::State &state, Operation operation) {
+    Matrix source = firstOperand(state);
+    source.setCopyOnWrite(false);
+    const Matrix two = secondOperand(state);
+    const bool grows = two.getRows() > source.getRows() || two.getColumns() > source.getColumns();
+
+    Matrix one(source);
+    for (auto _: state) {
+        if (grows) {
+            state.PauseTiming();
+            one = source;
+            state.ResumeTiming();
+        }
+        operation(one, two);
+        benchmark::DoNotOptimize(&one);
+    }
+    reportOperation(state, source, two, one);
+}
+// endregion
+
+// region Construction, copy and move
+
+static void BM_ConstructRandom(benchmark::State &state) {
+    const auto rows = unsigned(state.range(0)), columns = unsigned(state.range(1)), modulo = unsigned(state.range(2));
+    for (auto _: state) {
+        Matrix matrix(rows, columns, modulo);
+        benchmark::DoNotOptimize(&matrix);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(rows) * columns * int64_t(sizeof(unsigned)));
+}
+BENCHMARK(BM_ConstructRandom)->Apply(matrixShapes);
+
+// A copy shares the elements of the source (copy-on-write), it reads no element
+static void BM_CopyShared(benchmark::State &state) {
+    const Matrix source(unsigned(state.range(0)), unsigned(state.range(1)), unsigned(state.range(2)));
+    for (auto _: state) {
+        Matrix copy(source);
+        benchmark::DoNotOptimize(&copy);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_CopyShared)->Apply(matrixShapes);
+
+// Without copy-on-write, the copy duplicates the elements
+static void BM_CopyDeep(benchmark::State &state) {
+    Matrix source(unsigned(state.range(0)), unsigned(state.range(1)), unsigned(state.range(2)));
+    source.setCopyOnWrite(false);
+    for (auto _: state) {
+        Matrix copy(source);
+        benchmark::DoNotOptimize(&copy);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * 2 * matrixBytes(source));
+}
+BENCHMARK(BM_CopyDeep)->Apply(matrixShapes);
+
+static void BM_CopyAssign(benchmark::State &state) {
+    Matrix source(unsigned(state.range(0)), unsigned(state.range(1)), unsigned(state.range(2)));
+    source.setCopyOnWrite(false);
+    Matrix target(source);
+    for (auto _: state) {
+        target = source;
+        benchmark::DoNotOptimize(&target);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * 2 * matrixBytes(source));
+}
+BENCHMARK(BM_CopyAssign)->Apply(matrixShapes);
+
+static void BM_MoveConstructAndAssign(benchmark::State &state) {
+    Matrix first(unsigned(state.range(0)), unsigned(state.range(1)), unsigned(state.range(2)));
+    Matrix second(first);
+    for (auto _: state) {
+        Matrix moved(std::move(first));
+        first = std::move(second);
+        second = std::move(moved);
+        benchmark::DoNotOptimize(&first);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_MoveConstructAndAssign)->Apply(matrixShapes);
+// endregion
+
+// region Operations
+
+static void BM_AddInPlace(benchmark::State &state) {
+    benchmarkInPlace(state, [](Matrix &one, const Matrix &two) { one.add(two); });
+}
+BENCHMARK(BM_AddInPlace)->Apply(operationShapes);
+
+static void BM_AddStatic(benchmark::State &state) {
+    const Matrix one = firstOperand(state), two = secondOperand(state);
+    for (auto _: state) {
+        Matrix result = one.addStatic(two);
+        benchmark::DoNotOptimize(&result);
+    }
+    reportOperation(state, one, two, one.addStatic(two));
+}
+BENCHMARK(BM_AddStatic)->Apply(operationShapes);
+
+static void BM_SubInPlace(benchmark::State &state) {
+    benchmarkInPlace(state, [](Matrix &one, const Matrix &two) { one.sub(two); });
+}
+BENCHMARK(BM_SubInPlace)->Apply(operationShapes);
+
+static void BM_SubStatic(benchmark::State &state) {
+    const Matrix one = firstOperand(state), two = secondOperand(state);
+    for (auto _: state) {
+        Matrix result = one.subStatic(two);
+        benchmark::DoNotOptimize(&result);
+    }
+    reportOperation(state, one, two, one.subStatic(two));
+}
+BENCHMARK(BM_SubStatic)->Apply(operationShapes);
+
+static void BM_MultiplyInPlace(benchmark::State &state) {
+    benchmarkInPlace(state, [](Matrix &one, const Matrix &two) { one.multiply(two); });
+}
+BENCHMARK(BM_MultiplyInPlace)->Apply(operationShapes);
+
+static void BM_MultiplyStatic(benchmark::State &state) {
+    const Matrix one = firstOperand(state), two = secondOperand(state);
+    for (auto _: state) {
+        Matrix result = one.multiplyStatic(two);
+        benchmark::DoNotOptimize(&result);
+    }
+    reportOperation(state, one, two, one.multiplyStatic(two));
+}
+BENCHMARK(BM_MultiplyStatic)->Apply(operationShapes);
+
+// The matrix product of the row-major and of the tiled representations, on square matrices. The sizes registered by
+// default fit in the last level cache of most machines, LABMATRIX_BENCH_LARGE=1 adds sizes beyond it (see main)
+static void BM_Product(benchmark::State &state) {
+    const auto size = unsigned(state.range(0));
+    const Matrix one(size, size, unsigned(state.range(1))), two(size, size, unsigned(state.range(1)));
+    CacheMissCounter misses;
+    for (auto _: state) {
+        Matrix result = one.product(two);
+        benchmark::DoNotOptimize(&result);
+    }
+    reportOperation(state, one, two, one);
+    reportCache(state, misses, one);
+}
+BENCHMARK(BM_Product)->ArgNames({"size", "mod"})->ArgsProduct({{64, 256, 512}, {65521, 4294967291}})->UseRealTime();
+
+static void BM_TiledProduct(benchmark::State &state) {
+    const auto size = unsigned(state.range(0));
+    const Matrix one(size, size, unsigned(state.range(1))), two(size, size, unsigned(state.range(1)));
+    const TiledMatrix tiledOne(one), tiledTwo(two);
+    CacheMissCounter misses;
+    for (auto _: state) {
+        TiledMatrix result = tiledOne.product(tiledTwo);
+        benchmark::DoNotOptimize(&result);
+    }
+    reportOperation(state, one, two, one);
+    reportCache(state, misses, one);
+}
+BENCHMARK(BM_TiledProduct)->ArgNames({"size", "mod"})->ArgsProduct({{64, 256, 512}, {65521, 4294967291}})
+        ->UseRealTime();
+// endregion
+
+// region Printing
+
+static void BM_Print(benchmark::State &state) {
+    const Matrix matrix(unsigned(state.range(0)), unsigned(state.range(1)), unsigned(state.range(2)));
+    int64_t bytes = 0;
+    for (auto _: state) {
+        std::ostringstream stream;
+        stream << matrix;
+        bytes += int64_t(stream.tellp());
+    }
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_Print)->ArgNames({"rows", "cols", "mod"})->ArgsProduct({{64, 256}, {64, 256}, {7, 4294967291}});
+// endregion
+
+int main(int argc, char **argv) {
+    // Seeded, the random matrices are the same on every run and much faster to generate
+    Utils::setSeed(42);
+
+    // Operands of 16 MB and 64 MB, beyond the last level cache of most machines: minutes of products, so only on demand
+    const char *large = std::getenv("LABMATRIX_BENCH_LARGE");
+    if (large != nullptr && std::string(large) != "0") {
+        for (auto product: {std::make_pair("BM_Product", BM_Product),
+                            std::make_pair("BM_TiledProduct", BM_TiledProduct)}) {
+            benchmark::RegisterBenchmark(product.first, product.second)->ArgNames({"size", "mod"})
+                    ->ArgsProduct({{2048, 4096}, {65521}})->Iterations(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include "AsyncMatrix.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+// region Node
+
+struct AsyncMatrix::Node {
+    Executor &executor;
+    std::mutex mutex;
+    std::condition_variable doneCondition;
+    bool done = false;
+    // Written once, before done is set, then only read
+    std::optional<Matrix> value;
+    std::exception_ptr error;
+    // Called once the node is done, they queue the tasks depending on it
+    std::vector<std::function<void()>> continuations;
+
+    explicit Node(Executor &executor) : executor(executor) {}
+
+    /**
+     * @brief Stores the matrix, or the error, then calls the continuations outside of the mutex.
+     */
+    void finish(std::optional<Matrix> matrix, std::exception_ptr exception) {
+        std::vector<std::function<void()>> waiting;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            value = std::move(matrix);
+            error = std::move(exception);
+            done = true;
+            waiting.swap(continuations);
+        }
+        doneCondition.notify_all();
+        for (auto &continuation: waiting) {
+            continuation();
+        }
+    }
+
+    /**
+     * @brief Calls a function once the node is done, immediately if it is already done.
+     */
+    void whenDone(std::function<void()> continuation) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!done) {
+                continuations.push_back(std::move(continuation));
+                return;
+            }
+        }
+        continuation();
+    }
+};
+// endregion
+
+// region Constructors
+
+AsyncMatrix::AsyncMatrix(std::shared_ptr<Node> node) : node(std::move(node)) {}
+
+AsyncMatrix AsyncMatrix::ready(const Matrix &matrix, Executor &executor) {
+    auto node = std::make_shared<Node>(executor);
+    node->finish(matrix, nullptr);
+    return AsyncMatrix(node);
+}
+
+AsyncMatrix AsyncMatrix::run(std::function<Matrix()> task, Executor &executor) {
+    return schedule(executor, {}, std::move(task));
+}
+
+AsyncMatrix AsyncMatrix::random(unsigned rows, unsigned columns, unsigned modulo, Executor &executor) {
+    return run([rows, columns, modulo] { return Matrix(rows, columns, modulo); }, executor);
+}
+// endregion
+
+// region Public Methods
+
+AsyncMatrix AsyncMatrix::then(std::function<Matrix(const Matrix &)> function) const {
+    return schedule(node->executor, {node}, [input = node, function = std::move(function)] {
+        return function(*input->value);
+    });
+}
+
+AsyncMatrix AsyncMatrix::combine(const AsyncMatrix &lhs, const AsyncMatrix &rhs,
+                                 std::function<Matrix(const Matrix &, const Matrix &)> function) {
+    return schedule(lhs.node->executor, {lhs.node, rhs.node},
+                    [left = lhs.node, right = rhs.node, function = std::move(function)] {
+                        return function(*left->value, *right->value);
+                    });
+}
+
+AsyncMatrix AsyncMatrix::add(const AsyncMatrix &other) const {
+    return combine(*this, other, [](const Matrix &lhs, const Matrix &rhs) { return lhs + rhs; });
+}
+
+AsyncMatrix AsyncMatrix::sub(const AsyncMatrix &other) const {
+    return combine(*this, other, [](const Matrix &lhs, const Matrix &rhs) { return lhs - rhs; });
+}
+
+AsyncMatrix AsyncMatrix::multiply(const AsyncMatrix &other) const {
+    return combine(*this, other, [](const Matrix &lhs, const Matrix &rhs) { return lhs * rhs; });
+}
+
+AsyncMatrix AsyncMatrix::product(const AsyncMatrix &other) const {
+    return combine(*this, other, [](const Matrix &lhs, const Matrix &rhs) { return lhs.product(rhs); });
+}
+
+AsyncMatrix AsyncMatrix::addScalar(unsigned scalar) const {
+    return then([scalar](const Matrix &matrix) { return matrix.addScalarStatic(scalar); });
+}
+
+AsyncMatrix AsyncMatrix::multiplyScalar(unsigned scalar) const {
+    return then([scalar](const Matrix &matrix) { return matrix.multiplyScalarStatic(scalar); });
+}
+
+AsyncMatrix AsyncMatrix::transpose() const {
+    return then([](const Matrix &matrix) { return matrix.transpose(); });
+}
+
+bool AsyncMatrix::isReady() const {
+    std::lock_guard<std::mutex> lock(node->mutex);
+    return node->done;
+}
+
+void AsyncMatrix::wait() const {
+    std::unique_lock<std::mutex> lock(node->mutex);
+    node->doneCondition.wait(lock, [this] { return node->done; });
+}
+
+const Matrix &AsyncMatrix::get() const {
+    wait();
+    if (node->error) {
+        std::rethrow_exception(node->error);
+    }
+    return *node->value;
+}
+// endregion
+
+// region Private Methods
+
+AsyncMatrix AsyncMatrix::schedule(Executor &executor, std::vector<std::shared_ptr<Node>> inputs,
+                                  std::function<Matrix()> task) {
+    auto node = std::make_shared<Node>(executor);
+
+    // The continuations of the inputs keep this task, they are released once the inputs are done
+    auto start = [node, inputs, task = std::move(task)] {
+        for (const auto &input: inputs) {
+            if (input->error) {
+                node->finish(std::nullopt, input->error);
+                return;
+            }
+        }
+        try {
+            node->finish(task(), nullptr);
+        } catch (...) {
+            node->finish(std::nullopt, std::current_exception());
+        }
+    };
+
+    if (inputs.empty()) {
+        executor.post(std::move(start));
+        return AsyncMatrix(node);
+    }
+
+    // The last input done queues the task, no thread waits for the others
+    auto pending = std::make_shared<std::atomic<std::size_t>>(inputs.size());
+    for (const auto &input: inputs) {
+        input->whenDone([&executor, pending, start] {
+            if (pending->fetch_sub(1) == 1) {
+                executor.post(start);
+            }
+        });
+    }
+    return AsyncMatrix(node);
+}
+// endregion
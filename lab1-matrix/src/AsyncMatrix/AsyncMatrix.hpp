@@ -0,0 +1,126 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+#include "../Utils/Executor.h"
+
+/**
+ * @class AsyncMatrix
+ * @brief Future of a matrix computed on an executor, the node of a graph of dependent operations.
+ * @authors Slimani Walid, Van Hove Timothée
+ * An operation between asynchronous matrices returns immediately: its task is queued on the executor as soon as all
+ * its operands are computed, without a thread waiting for them. Independent operations (generation, arithmetic,
+ * output) thus run concurrently, and a chain of operations runs as a pipeline. The operands are copies of the
+ * computed matrices, which share their elements (copy-on-write), so no operation modifies another node.
+ * An exception thrown by a task is kept by its node and by all the nodes depending on it, get() rethrows it.
+ * Copies of an AsyncMatrix refer to the same node.
+ */
+class AsyncMatrix {
+private:
+    /** @brief The state shared by the copies of an asynchronous matrix and the tasks depending on it. */
+    struct Node;
+
+    std::shared_ptr<Node> node;
+
+    explicit AsyncMatrix(std::shared_ptr<Node> node);
+
+    /**
+     * @brief Creates a node computed by a task, queued once all the inputs are computed.
+     * @param executor The executor running the task.
+     * @param inputs The nodes the task reads, the node fails without running the task if one of them failed.
+     * @param task The task computing the matrix.
+     * @return The asynchronous matrix of the node.
+     */
+    static AsyncMatrix schedule(Executor &executor, std::vector<std::shared_ptr<Node>> inputs,
+                                std::function<Matrix()> task);
+
+public:
+    // region Ctors
+    AsyncMatrix() = delete;
+
+    /**
+     * @brief Wraps a matrix already computed.
+     * @param matrix The matrix, its elements are shared.
+     * @param executor The executor running the operations on this matrix.
+     * @return The asynchronous matrix, ready.
+     */
+    static AsyncMatrix ready(const Matrix &matrix, Executor &executor = Executor::shared());
+
+    /**
+     * @brief Computes a matrix with a task, for example by reading a file.
+     * @param task The task computing the matrix.
+     * @param executor The executor running the task and the operations on the result.
+     * @return The asynchronous matrix.
+     */
+    static AsyncMatrix run(std::function<Matrix()> task, Executor &executor = Executor::shared());
+
+    /**
+     * @brief Generates a matrix filled with random values.
+     * @param rows Number of rows of the matrix.
+     * @param columns Number of columns of the matrix.
+     * @param modulo Modulo of the matrix.
+     * @param executor The executor running the generation and the operations on the result.
+     * @return The asynchronous matrix, get() throws the exceptions of the constructor of Matrix.
+     */
+    static AsyncMatrix random(unsigned rows, unsigned columns, unsigned modulo,
+                              Executor &executor = Executor::shared());
+    // endregion
+
+    // region Public methods
+
+    /**
+     * @brief Applies a function to this matrix once it is computed.
+     * @param function The function, for example writing the matrix and returning it.
+     * @return The asynchronous result of the function.
+     */
+    [[nodiscard]] AsyncMatrix then(std::function<Matrix(const Matrix &)> function) const;
+
+    /**
+     * @brief Applies a function to two matrices once both are computed, on the executor of the left one.
+     * @param lhs The left-hand side matrix.
+     * @param rhs The right-hand side matrix.
+     * @param function The function.
+     * @return The asynchronous result of the function.
+     */
+    [[nodiscard]] static AsyncMatrix combine(const AsyncMatrix &lhs, const AsyncMatrix &rhs,
+                                             std::function<Matrix(const Matrix &, const Matrix &)> function);
+
+    /** @return The asynchronous sum of this matrix and another one, as operator+. */
+    [[nodiscard]] AsyncMatrix add(const AsyncMatrix &other) const;
+
+    /** @return The asynchronous difference of this matrix and another one, as operator-. */
+    [[nodiscard]] AsyncMatrix sub(const AsyncMatrix &other) const;
+
+    /** @return The asynchronous component by component product of this matrix and another one, as operator*. */
+    [[nodiscard]] AsyncMatrix multiply(const AsyncMatrix &other) const;
+
+    /** @return The asynchronous matrix product of this matrix by another one, as Matrix::product. */
+    [[nodiscard]] AsyncMatrix product(const AsyncMatrix &other) const;
+
+    /** @return The asynchronous sum of this matrix and a scalar, as Matrix::addScalarStatic. */
+    [[nodiscard]] AsyncMatrix addScalar(unsigned scalar) const;
+
+    /** @return The asynchronous product of this matrix by a scalar, as Matrix::multiplyScalarStatic. */
+    [[nodiscard]] AsyncMatrix multiplyScalar(unsigned scalar) const;
+
+    /** @return The asynchronous transpose of this matrix, as Matrix::transpose. */
+    [[nodiscard]] AsyncMatrix transpose() const;
+
+    /** @return true if the matrix is computed, or its computation failed. */
+    [[nodiscard]] bool isReady() const;
+
+    /** @brief Waits until the matrix is computed, or its computation failed. */
+    void wait() const;
+
+    /**
+     * @brief Waits until the matrix is computed and gets it.
+     * @note Waiting in a task of the executor can exhaust its threads, chain the operations with then() instead.
+     * @return The matrix, it lives as long as a copy of this asynchronous matrix.
+     * @throws The exception thrown by the computation of this matrix or of one of its operands.
+     */
+    [[nodiscard]] const Matrix &get() const;
+
+    // endregion
+};
@@ -0,0 +1,411 @@
+#include "BandMatrix.hpp"
+#include <cstring>
+#include <stdexcept>
+#include "../Utils/Modular.h"
+#include "../Utils/Parallel.h"
+#include "../Utils/Tuning.h"
+
+// region Constructors
+
+BandMatrix::BandMatrix(unsigned rows, unsigned columns, unsigned lower, unsigned upper, unsigned modulo)
+        : rows(rows), columns(columns), modulo(modulo), lower(0), upper(0) {
+    checkArguments(rows, columns, modulo);
+
+    // The diagonals beyond the first column or the last column are always empty
+    this->lower = std::min(lower, rows - 1);
+    this->upper = std::min(upper, columns - 1);
+    data.assign(std::size_t(rows) * width(), 0);
+}
+
+BandMatrix::BandMatrix(const Matrix &dense, unsigned lower, unsigned upper)
+        : BandMatrix(dense.rows, dense.columns, lower, upper, dense.modulo) {
+    dense.checkData();
+    for (unsigned i = 0; i < rows; ++i) {
+        const unsigned *row = dense.rowData(i);
+        for (unsigned j = firstColumn(i); j < endColumn(i); ++j) {
+            at(i, j) = row[j];
+        }
+    }
+}
+// endregion
+
+// region Public Methods
+
+unsigned BandMatrix::get(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    return valueAt(rowIndex, columnIndex);
+}
+
+void BandMatrix::set(unsigned rowIndex, unsigned columnIndex, unsigned value) {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    if (columnIndex < firstColumn(rowIndex) || columnIndex >= endColumn(rowIndex)) {
+        throw std::out_of_range("The element is outside the band");
+    }
+    at(rowIndex, columnIndex) = value % modulo;
+}
+
+Matrix BandMatrix::toDense() const {
+    Matrix result = Matrix::zeros(rows, columns, modulo);
+    for (unsigned i = 0; i < rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (unsigned j = firstColumn(i); j < endColumn(i); ++j) {
+            row[j] = at(i, j);
+        }
+    }
+    return result;
+}
+
+BandMatrix BandMatrix::transpose() const {
+    BandMatrix result(columns, rows, upper, lower, modulo);
+    for (unsigned i = 0; i < rows; ++i) {
+        for (unsigned j = firstColumn(i); j < endColumn(i); ++j) {
+            result.at(j, i) = at(i, j);
+        }
+    }
+    return result;
+}
+
+// region Add
+BandMatrix &BandMatrix::add(const BandMatrix &other) {
+    *this = addStatic(other);
+    return *this;
+}
+
+BandMatrix BandMatrix::addStatic(const BandMatrix &other) const {
+    unsigned mod = modulo;
+    return merge(other, std::max(lower, other.lower), std::max(upper, other.upper),
+                 [mod](unsigned n, unsigned m) { return Modular::add(n, m, mod); });
+}
+
+Matrix BandMatrix::addStatic(const Matrix &other) const {
+    checkModulo(other.modulo);
+    Matrix result = paddedCopy(other);
+
+    // Only the band changes the dense copy
+    for (unsigned i = 0; i < rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (unsigned j = firstColumn(i); j < endColumn(i); ++j) {
+            row[j] = Modular::add(row[j], at(i, j), modulo);
+        }
+    }
+    return result;
+}
+// endregion
+
+// region Sub
+BandMatrix &BandMatrix::sub(const BandMatrix &other) {
+    *this = subStatic(other);
+    return *this;
+}
+
+BandMatrix BandMatrix::subStatic(const BandMatrix &other) const {
+    unsigned mod = modulo;
+    return merge(other, std::max(lower, other.lower), std::max(upper, other.upper),
+                 [mod](unsigned n, unsigned m) { return Modular::sub(n, m, mod); });
+}
+
+Matrix BandMatrix::subStatic(const Matrix &other) const {
+    checkModulo(other.modulo);
+    Matrix result = paddedCopy(other);
+
+    // Negate the dense operand, then add the band
+    for (unsigned i = 0; i < result.rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (unsigned j = 0; j < result.columns; ++j) {
+            row[j] = Modular::sub(0, row[j], modulo);
+        }
+        if (i < rows) {
+            for (unsigned j = firstColumn(i); j < endColumn(i); ++j) {
+                row[j] = Modular::add(row[j], at(i, j), modulo);
+            }
+        }
+    }
+    return result;
+}
+// endregion
+
+// region Multiply
+BandMatrix &BandMatrix::multiply(const BandMatrix &other) {
+    *this = multiplyStatic(other);
+    return *this;
+}
+
+BandMatrix BandMatrix::multiplyStatic(const BandMatrix &other) const {
+    unsigned mod = modulo;
+    return merge(other, std::min(lower, other.lower), std::min(upper, other.upper),
+                 [mod](unsigned n, unsigned m) { return Modular::multiply(n, m, mod); });
+}
+
+BandMatrix BandMatrix::multiplyStatic(const Matrix &other) const {
+    checkModulo(other.modulo);
+    BandMatrix result(std::max(rows, other.rows), std::max(columns, other.columns), lower, upper, modulo);
+
+    // Elements outside of the dense matrix are multiplied by 0
+    for (unsigned i = 0; i < std::min(rows, other.rows); ++i) {
+        const unsigned *denseRow = other.rowData(i);
+        for (unsigned j = firstColumn(i); j < std::min(endColumn(i), other.columns); ++j) {
+            result.at(i, j) = Modular::multiply(at(i, j), denseRow[j], modulo);
+        }
+    }
+    return result;
+}
+// endregion
+
+// region Product
+BandMatrix BandMatrix::product(const BandMatrix &other) const {
+    checkModulo(other.modulo);
+    if (columns != other.rows) {
+        throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+    }
+
+    // The bandwidths add up, the constructor clips them to the dimensions of the result
+    const auto clip = [](std::size_t bandwidth) { return unsigned(std::min<std::size_t>(bandwidth, UINT32_MAX)); };
+    BandMatrix result(rows, other.columns, clip(std::size_t(lower) + other.lower),
+                      clip(std::size_t(upper) + other.upper), modulo);
+    const uint64_t interval = Modular::reductionInterval(modulo);
+    const std::size_t rowGrain = Tuning::productGrain() / (width() * other.width()) + 1;
+
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t first, std::size_t last) {
+        std::vector<uint64_t> accumulator(result.width());
+        for (auto i = unsigned(first); i < last; ++i) {
+            const unsigned resultFirst = result.firstColumn(i), resultEnd = result.endColumn(i);
+            std::fill(accumulator.begin(), accumulator.end(), 0);
+            uint64_t pending = 0;
+
+            // Each element of the band of the row scales the band of a row of the right matrix, which lies within
+            // the band of the result
+            for (unsigned k = firstColumn(i); k < endColumn(i); ++k) {
+                const uint64_t value = at(i, k);
+                if (value == 0) {
+                    continue;
+                }
+                for (unsigned j = other.firstColumn(k); j < other.endColumn(k); ++j) {
+                    accumulator[j - resultFirst] += value * other.at(k, j);
+                }
+                if (++pending == interval) {
+                    for (uint64_t &sum: accumulator) {
+                        sum %= modulo;
+                    }
+                    pending = 0;
+                }
+            }
+
+            for (unsigned j = resultFirst; j < resultEnd; ++j) {
+                result.at(i, j) = unsigned(accumulator[j - resultFirst] % modulo);
+            }
+        }
+    });
+    return result;
+}
+
+Matrix BandMatrix::product(const Matrix &other) const {
+    checkModulo(other.modulo);
+    if (columns != other.rows) {
+        throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+    }
+
+    Matrix result = Matrix::zeros(rows, other.columns, modulo);
+    const uint64_t interval = Modular::reductionInterval(modulo);
+    const std::size_t rowGrain = Tuning::productGrain() / (width() * other.columns) + 1;
+
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t first, std::size_t last) {
+        std::vector<uint64_t> accumulator(other.columns);
+        for (auto i = unsigned(first); i < last; ++i) {
+            std::fill(accumulator.begin(), accumulator.end(), 0);
+            uint64_t pending = 0;
+
+            // Only the rows of the dense matrix within the band are combined
+            for (unsigned k = firstColumn(i); k < endColumn(i); ++k) {
+                const uint64_t value = at(i, k);
+                if (value == 0) {
+                    continue;
+                }
+                const unsigned *denseRow = other.rowData(k);
+                for (unsigned j = 0; j < other.columns; ++j) {
+                    accumulator[j] += value * denseRow[j];
+                }
+                if (++pending == interval) {
+                    for (uint64_t &sum: accumulator) {
+                        sum %= modulo;
+                    }
+                    pending = 0;
+                }
+            }
+
+            unsigned *row = result.rowData(i);
+            for (unsigned j = 0; j < other.columns; ++j) {
+                row[j] = unsigned(accumulator[j] % modulo);
+            }
+        }
+    });
+    return result;
+}
+
+Matrix BandMatrix::leftProduct(const Matrix &other) const {
+    checkModulo(other.modulo);
+    if (other.columns != rows) {
+        throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+    }
+
+    Matrix result = Matrix::zeros(other.rows, columns, modulo);
+    const uint64_t interval = Modular::reductionInterval(modulo);
+    const std::size_t rowGrain = Tuning::productGrain() / (std::size_t(rows) * width()) + 1;
+
+    Parallel::forRange(0, other.rows, rowGrain, [&](std::size_t first, std::size_t last) {
+        std::vector<uint64_t> accumulator(columns);
+        for (auto i = unsigned(first); i < last; ++i) {
+            std::fill(accumulator.begin(), accumulator.end(), 0);
+            uint64_t pending = 0;
+
+            // Each element of the dense row only reaches the band of the matching row of this matrix
+            const unsigned *denseRow = other.rowData(i);
+            for (unsigned k = 0; k < rows; ++k) {
+                const uint64_t value = denseRow[k];
+                if (value == 0) {
+                    continue;
+                }
+                for (unsigned j = firstColumn(k); j < endColumn(k); ++j) {
+                    accumulator[j] += value * at(k, j);
+                }
+                if (++pending == interval) {
+                    for (uint64_t &sum: accumulator) {
+                        sum %= modulo;
+                    }
+                    pending = 0;
+                }
+            }
+
+            unsigned *row = result.rowData(i);
+            for (unsigned j = 0; j < columns; ++j) {
+                row[j] = unsigned(accumulator[j] % modulo);
+            }
+        }
+    });
+    return result;
+}
+// endregion
+// endregion
+
+// region Operators
+
+std::ostream &operator<<(std::ostream &os, const BandMatrix &matrix) {
+    for (unsigned i = 0; i < matrix.rows; ++i) {
+        for (unsigned j = 0; j < matrix.columns; ++j) {
+            os << matrix.valueAt(i, j) << " ";
+        }
+        os << std::endl;
+    }
+    return os;
+}
+
+Matrix operator-(const Matrix &lhs, const BandMatrix &rhs) {
+    return rhs.subtractFrom(lhs);
+}
+
+BandMatrix operator+(const BandMatrix &lhs, const BandMatrix &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+BandMatrix operator-(const BandMatrix &lhs, const BandMatrix &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+BandMatrix operator*(const BandMatrix &lhs, const BandMatrix &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+
+Matrix operator+(const BandMatrix &lhs, const Matrix &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+Matrix operator+(const Matrix &lhs, const BandMatrix &rhs) {
+    return rhs.addStatic(lhs);
+}
+
+Matrix operator-(const BandMatrix &lhs, const Matrix &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+BandMatrix operator*(const BandMatrix &lhs, const Matrix &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+
+BandMatrix operator*(const Matrix &lhs, const BandMatrix &rhs) {
+    return rhs.multiplyStatic(lhs);
+}
+// endregion
+
+// region Private Methods
+
+void BandMatrix::checkArguments(unsigned rows, unsigned columns, unsigned modulo) {
+    if (modulo < 1) {
+        throw std::invalid_argument("modulo cannot be zero or less");
+    }
+
+    if (rows < 1) {
+        throw std::runtime_error("rows cannot be less than 1");
+    }
+
+    if (columns < 1) {
+        throw std::runtime_error("columns cannot be less than 1");
+    }
+}
+
+void BandMatrix::checkModulo(unsigned otherModulo) const {
+    if (otherModulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+}
+
+unsigned BandMatrix::valueAt(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= rows || columnIndex < firstColumn(rowIndex) || columnIndex >= endColumn(rowIndex)) {
+        return 0;
+    }
+    return at(rowIndex, columnIndex);
+}
+
+template<typename Combine>
+BandMatrix BandMatrix::merge(const BandMatrix &other, unsigned resultLower, unsigned resultUpper,
+                             Combine combine) const {
+    checkModulo(other.modulo);
+    BandMatrix result(std::max(rows, other.rows), std::max(columns, other.columns), resultLower, resultUpper, modulo);
+
+    // Only the band of the result is visited, the elements outside of a band are 0
+    for (unsigned i = 0; i < result.rows; ++i) {
+        for (unsigned j = result.firstColumn(i); j < result.endColumn(i); ++j) {
+            result.at(i, j) = combine(valueAt(i, j), other.valueAt(i, j));
+        }
+    }
+    return result;
+}
+
+Matrix BandMatrix::paddedCopy(const Matrix &dense) const {
+    if (dense.rows >= rows && dense.columns >= columns) {
+        return dense;
+    }
+
+    Matrix result = Matrix::zeros(std::max(rows, dense.rows), std::max(columns, dense.columns), modulo);
+    for (unsigned i = 0; i < dense.rows; ++i) {
+        std::memcpy(result.rowData(i), dense.rowData(i), dense.columns * sizeof(unsigned));
+    }
+    return result;
+}
+
+Matrix BandMatrix::subtractFrom(const Matrix &dense) const {
+    checkModulo(dense.modulo);
+    Matrix result = paddedCopy(dense);
+
+    // Only the band changes the dense copy
+    for (unsigned i = 0; i < rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (unsigned j = firstColumn(i); j < endColumn(i); ++j) {
+            row[j] = Modular::sub(row[j], at(i, j), modulo);
+        }
+    }
+    return result;
+}
+// endregion
@@ -0,0 +1,397 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class BandMatrix
+ * @brief Represents a matrix with elements stored modulo n whose non-zero elements are all within a band around the
+ * diagonal.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The element (i, j) can only be non-zero when i - lower <= j <= i + upper. Only the band is stored, row after row
+ * (lower + upper + 1 elements per row), so the memory footprint and the cost of the operations scale with
+ * rows x bandwidth instead of rows x columns. Diagonal (0, 0), tridiagonal (1, 1), lower triangular (rows - 1, 0) and
+ * upper triangular (0, columns - 1) matrices are band matrices, see the factory methods.
+ * The semantics are the same as Matrix: both operands must have the same modulo and an operand smaller than the other
+ * one is considered padded with zeros.
+ */
+class BandMatrix {
+private:
+    // region Fields
+
+    unsigned rows, columns, modulo;
+
+    // Number of diagonals below and above the main diagonal, at most rows - 1 and columns - 1
+    unsigned lower, upper;
+
+    // The band of each row, the element (i, j) is at i * width() + j + lower - i. The positions outside of the matrix
+    // (first and last rows) are always 0.
+    std::vector<unsigned> data;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Checks that the given matrix dimensions and modulo are valid.
+     * @throws std::invalid_argument if the modulo is 0.
+     * @throws std::runtime_error if the number of rows or columns is 0.
+     */
+    static void checkArguments(unsigned rows, unsigned columns, unsigned modulo);
+
+    /**
+     * @brief Checks that the modulo of another matrix is the same as the one of this matrix.
+     * @param otherModulo The modulo of the other matrix.
+     * @throws std::invalid_argument if the moduli are different.
+     */
+    void checkModulo(unsigned otherModulo) const;
+
+    /** @return The number of elements stored per row. */
+    [[nodiscard]] std::size_t width() const { return std::size_t(lower) + upper + 1; }
+
+    /**
+     * @brief Gets the first column of the band of a row.
+     * @param rowIndex The row index.
+     * @return The first column, may be beyond the last column of the matrix.
+     */
+    [[nodiscard]] unsigned firstColumn(unsigned rowIndex) const { return rowIndex > lower ? rowIndex - lower : 0; }
+
+    /**
+     * @brief Gets the column after the last one of the band of a row.
+     * @param rowIndex The row index.
+     * @return The end column, at most the number of columns.
+     */
+    [[nodiscard]] unsigned endColumn(unsigned rowIndex) const {
+        return unsigned(std::min<std::size_t>(columns, std::size_t(rowIndex) + upper + 1));
+    }
+
+    /**
+     * @brief Gets an element of the band.
+     * @param rowIndex The row index, must be lower than the number of rows.
+     * @param columnIndex The column index, must be within the band of the row.
+     * @return A reference to the element.
+     */
+    [[nodiscard]] unsigned &at(unsigned rowIndex, unsigned columnIndex) {
+        return data[std::size_t(rowIndex) * width() + columnIndex + lower - rowIndex];
+    }
+
+    /** @copydoc at */
+    [[nodiscard]] unsigned at(unsigned rowIndex, unsigned columnIndex) const {
+        return data[std::size_t(rowIndex) * width() + columnIndex + lower - rowIndex];
+    }
+
+    /**
+     * @brief Gets an element, 0 outside of the band or of the matrix.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element.
+     */
+    [[nodiscard]] unsigned valueAt(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Combines each element of the band of the result with the elements at the same position in both operands.
+     * @param other The other band matrix.
+     * @param resultLower The number of diagonals below the main one in the result.
+     * @param resultUpper The number of diagonals above the main one in the result.
+     * @param combine The modular operation applied to each pair of elements.
+     * @return The resulting band matrix, large enough to hold both operands.
+     */
+    template<typename Combine>
+    [[nodiscard]] BandMatrix merge(const BandMatrix &other, unsigned resultLower, unsigned resultUpper,
+                                   Combine combine) const;
+
+    /**
+     * @brief Copies a dense matrix into a new dense matrix large enough to hold this band matrix.
+     * @param dense The dense matrix to copy.
+     * @return A copy of the dense matrix padded with zeros.
+     */
+    [[nodiscard]] Matrix paddedCopy(const Matrix &dense) const;
+
+    /**
+     * @brief Creates a new dense matrix that is the result of subtracting this matrix from a dense matrix.
+     * @param dense The dense matrix to subtract this matrix from.
+     * @return A new Matrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] Matrix subtractFrom(const Matrix &dense) const;
+
+    // endregion
+
+public:
+    // region Ctors
+    BandMatrix() = delete;
+
+    /**
+    * @brief Constructs a BandMatrix whose elements are all 0.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param lower Number of diagonals below the main one, reduced to rows - 1.
+    * @param upper Number of diagonals above the main one, reduced to columns - 1.
+    * @param modulo The modulo value for matrix operations.
+    */
+    BandMatrix(unsigned rows, unsigned columns, unsigned lower, unsigned upper, unsigned modulo);
+
+    /**
+    * @brief Constructs a BandMatrix holding the elements of a dense matrix within a band, the others are dropped.
+    * @param dense The dense matrix to convert.
+    * @param lower Number of diagonals below the main one, reduced to rows - 1.
+    * @param upper Number of diagonals above the main one, reduced to columns - 1.
+    */
+    BandMatrix(const Matrix &dense, unsigned lower, unsigned upper);
+    // endregion
+
+    // region Factories
+
+    /**
+     * @brief Creates a diagonal matrix from the diagonal of a dense matrix.
+     * @param dense The dense matrix.
+     * @return The diagonal matrix.
+     */
+    static BandMatrix diagonal(const Matrix &dense) { return {dense, 0, 0}; }
+
+    /**
+     * @brief Creates a tridiagonal matrix from the three central diagonals of a dense matrix.
+     * @param dense The dense matrix.
+     * @return The tridiagonal matrix.
+     */
+    static BandMatrix tridiagonal(const Matrix &dense) { return {dense, 1, 1}; }
+
+    /**
+     * @brief Creates a lower triangular matrix from the elements on and below the diagonal of a dense matrix.
+     * @param dense The dense matrix.
+     * @return The lower triangular matrix.
+     */
+    static BandMatrix lowerTriangular(const Matrix &dense) { return {dense, dense.getRows(), 0}; }
+
+    /**
+     * @brief Creates an upper triangular matrix from the elements on and above the diagonal of a dense matrix.
+     * @param dense The dense matrix.
+     * @return The upper triangular matrix.
+     */
+    static BandMatrix upperTriangular(const Matrix &dense) { return {dense, 0, dense.getColumns()}; }
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of rows of the matrix. */
+    [[nodiscard]] unsigned getRows() const { return rows; }
+
+    /** @return The number of columns of the matrix. */
+    [[nodiscard]] unsigned getColumns() const { return columns; }
+
+    /** @return The modulo applied to the elements of the matrix. */
+    [[nodiscard]] unsigned getModulo() const { return modulo; }
+
+    /** @return The number of diagonals below the main one. */
+    [[nodiscard]] unsigned getLowerBandwidth() const { return lower; }
+
+    /** @return The number of diagonals above the main one. */
+    [[nodiscard]] unsigned getUpperBandwidth() const { return upper; }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element, 0 outside of the band.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    [[nodiscard]] unsigned get(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Sets the value of an element of the band.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @param value The value, reduced modulo n.
+     * @throws std::out_of_range if the indices are outside the matrix or the band.
+     */
+    void set(unsigned rowIndex, unsigned columnIndex, unsigned value);
+
+    /**
+     * @brief Converts this matrix to a dense matrix.
+     * @return The dense matrix holding the same elements.
+     */
+    [[nodiscard]] Matrix toDense() const;
+
+    /**
+     * @brief Creates the transpose of this matrix, the bands below and above the diagonal are exchanged.
+     * @return A new BandMatrix instance that is the transpose of this matrix.
+     */
+    [[nodiscard]] BandMatrix transpose() const;
+
+    /**
+     * @brief Adds another band matrix to this matrix in-place, the band becomes the union of both bands.
+     * @param other The matrix to be added to this matrix.
+     * @return A reference to this matrix after the addition.
+     */
+    BandMatrix &add(const BandMatrix &other);
+
+    /**
+     * @brief Creates a new band matrix that is the result of adding another band matrix to this matrix.
+     * @param other The matrix to be added to this matrix.
+     * @return A new BandMatrix instance that is the result of the addition.
+     */
+    [[nodiscard]] BandMatrix addStatic(const BandMatrix &other) const;
+
+    /**
+     * @brief Creates a new dense matrix that is the result of adding a dense matrix to this matrix.
+     * @param other The matrix to be added to this matrix.
+     * @return A new Matrix instance that is the result of the addition.
+     */
+    [[nodiscard]] Matrix addStatic(const Matrix &other) const;
+
+    /**
+     * @brief Subtracts another band matrix to this matrix in-place, the band becomes the union of both bands.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A reference to this matrix after the subtraction.
+     */
+    BandMatrix &sub(const BandMatrix &other);
+
+    /**
+     * @brief Creates a new band matrix that is the result of subtracting another band matrix to this matrix.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A new BandMatrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] BandMatrix subStatic(const BandMatrix &other) const;
+
+    /**
+     * @brief Creates a new dense matrix that is the result of subtracting a dense matrix to this matrix.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A new Matrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] Matrix subStatic(const Matrix &other) const;
+
+    /**
+     * @brief Multiplies (component by component) another band matrix to this matrix in-place, the band becomes the
+     * intersection of both bands.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A reference to this matrix after the multiplication.
+     */
+    BandMatrix &multiply(const BandMatrix &other);
+
+    /**
+     * @brief Creates a new band matrix that is the component by component product of this matrix and another one.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A new BandMatrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] BandMatrix multiplyStatic(const BandMatrix &other) const;
+
+    /**
+     * @brief Creates a new band matrix that is the component by component product of this matrix and a dense one.
+     * Only the band of this matrix is visited, the result has the same band.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A new BandMatrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] BandMatrix multiplyStatic(const Matrix &other) const;
+
+    /**
+     * @brief Computes the matrix product of this matrix with another band matrix, whose band is the sum of both bands.
+     * @param other The right-hand side matrix, its number of rows must be the number of columns of this matrix.
+     * @return A new BandMatrix instance that is the result of the product.
+     * @throws std::invalid_argument if the moduli or the inner dimensions are different.
+     */
+    [[nodiscard]] BandMatrix product(const BandMatrix &other) const;
+
+    /**
+     * @brief Computes the matrix product of this matrix with a dense matrix, each row of the result only combines
+     * the rows of the dense matrix within the band.
+     * @param other The right-hand side dense matrix, its number of rows must be the number of columns of this matrix.
+     * @return A new Matrix instance that is the result of the product.
+     * @throws std::invalid_argument if the moduli or the inner dimensions are different.
+     */
+    [[nodiscard]] Matrix product(const Matrix &other) const;
+
+    /**
+     * @brief Computes the matrix product of a dense matrix with this matrix (other * this), each row of the dense
+     * matrix only reaches the columns within the band.
+     * @param other The left-hand side dense matrix, its number of columns must be the number of rows of this matrix.
+     * @return A new Matrix instance that is the result of the product.
+     * @throws std::invalid_argument if the moduli or the inner dimensions are different.
+     */
+    [[nodiscard]] Matrix leftProduct(const Matrix &other) const;
+
+    // endregion
+
+    // region Operators
+
+    /**
+    * @brief Stream insertion operator for BandMatrix class, prints the matrix in its dense form.
+    * @param os The output stream to insert into.
+    * @param matrix The BandMatrix object to insert into the stream.
+    * @return A reference to the modified output stream.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const BandMatrix &matrix);
+
+    /**
+     * @brief Subtracts a band matrix from a dense matrix.
+     * @param lhs The left-hand side dense matrix.
+     * @param rhs The right-hand side band matrix.
+     * @return A new dense matrix that is the result of the subtraction.
+     */
+    friend Matrix operator-(const Matrix &lhs, const BandMatrix &rhs);
+    // endregion
+};
+
+/**
+ * @brief Adds two band matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new band matrix that is the result of adding the two matrices.
+ */
+BandMatrix operator+(const BandMatrix &lhs, const BandMatrix &rhs);
+
+/**
+ * @brief Subtracts two band matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new band matrix that is the result of subtracting the two matrices.
+ */
+BandMatrix operator-(const BandMatrix &lhs, const BandMatrix &rhs);
+
+/**
+ * @brief Multiplies two band matrices component by component.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new band matrix that is the result of multiplying the two matrices.
+ */
+BandMatrix operator*(const BandMatrix &lhs, const BandMatrix &rhs);
+
+/**
+ * @brief Adds a band matrix and a dense matrix.
+ * @param lhs The left-hand side band matrix.
+ * @param rhs The right-hand side dense matrix.
+ * @return A new dense matrix that is the result of the addition.
+ */
+Matrix operator+(const BandMatrix &lhs, const Matrix &rhs);
+
+/**
+ * @brief Adds a dense matrix and a band matrix.
+ * @param lhs The left-hand side dense matrix.
+ * @param rhs The right-hand side band matrix.
+ * @return A new dense matrix that is the result of the addition.
+ */
+Matrix operator+(const Matrix &lhs, const BandMatrix &rhs);
+
+/**
+ * @brief Subtracts a dense matrix from a band matrix.
+ * @param lhs The left-hand side band matrix.
+ * @param rhs The right-hand side dense matrix.
+ * @return A new dense matrix that is the result of the subtraction.
+ */
+Matrix operator-(const BandMatrix &lhs, const Matrix &rhs);
+
+/**
+ * @brief Multiplies a band matrix and a dense matrix component by component.
+ * @param lhs The left-hand side band matrix.
+ * @param rhs The right-hand side dense matrix.
+ * @return A new band matrix that is the result of the multiplication.
+ */
+BandMatrix operator*(const BandMatrix &lhs, const Matrix &rhs);
+
+/**
+ * @brief Multiplies a dense matrix and a band matrix component by component.
+ * @param lhs The left-hand side dense matrix.
+ * @param rhs The right-hand side band matrix.
+ * @return A new band matrix that is the result of the multiplication.
+ */
+BandMatrix operator*(const Matrix &lhs, const BandMatrix &rhs);
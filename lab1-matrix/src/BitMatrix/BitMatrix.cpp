@@ -0,0 +1,211 @@
+#include "BitMatrix.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+// region Constructors
+
+BitMatrix::BitMatrix(unsigned rows, unsigned columns) : rows(rows), columns(columns),
+                                                        wordsPerRow((columns + WORD_BITS - 1) / WORD_BITS) {
+    if (rows < 1) {
+        throw std::runtime_error("rows cannot be less than 1");
+    }
+
+    if (columns < 1) {
+        throw std::runtime_error("columns cannot be less than 1");
+    }
+
+    words.assign(std::size_t(rows) * wordsPerRow, 0);
+}
+
+BitMatrix::BitMatrix(const Matrix &dense) : BitMatrix(dense.rows, dense.columns) {
+    if (dense.modulo != 2) {
+        throw std::invalid_argument("The modulo of the matrix must be 2");
+    }
+
+    for (unsigned i = 0; i < rows; ++i) {
+        const unsigned *denseRow = dense.rowData(i);
+        uint64_t *row = rowWords(i);
+        for (unsigned j = 0; j < columns; ++j) {
+            row[j / WORD_BITS] |= uint64_t(denseRow[j] & 1u) << (j % WORD_BITS);
+        }
+    }
+}
+// endregion
+
+// region Public Methods
+
+bool BitMatrix::get(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    return (rowWords(rowIndex)[columnIndex / WORD_BITS] >> (columnIndex % WORD_BITS)) & 1u;
+}
+
+void BitMatrix::set(unsigned rowIndex, unsigned columnIndex, bool value) {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    uint64_t &word = rowWords(rowIndex)[columnIndex / WORD_BITS];
+    const uint64_t mask = uint64_t(1) << (columnIndex % WORD_BITS);
+    word = value ? word | mask : word & ~mask;
+}
+
+Matrix BitMatrix::toMatrix() const {
+    Matrix result = Matrix::zeros(rows, columns, 2);
+    for (unsigned i = 0; i < rows; ++i) {
+        const uint64_t *row = rowWords(i);
+        unsigned *denseRow = result.rowData(i);
+        for (unsigned j = 0; j < columns; ++j) {
+            denseRow[j] = unsigned((row[j / WORD_BITS] >> (j % WORD_BITS)) & 1u);
+        }
+    }
+    return result;
+}
+
+// region Add
+BitMatrix &BitMatrix::add(const BitMatrix &other) {
+    applyWordOperation(other, [](uint64_t n, uint64_t m) { return n ^ m; });
+    return *this;
+}
+
+BitMatrix BitMatrix::addStatic(const BitMatrix &other) const {
+    BitMatrix result(*this);
+    result.add(other);
+    return result;
+}
+// endregion
+
+// region Sub
+BitMatrix &BitMatrix::sub(const BitMatrix &other) {
+    // -1 = 1 in GF(2)
+    return add(other);
+}
+
+BitMatrix BitMatrix::subStatic(const BitMatrix &other) const {
+    BitMatrix result(*this);
+    result.sub(other);
+    return result;
+}
+// endregion
+
+// region Multiply
+BitMatrix &BitMatrix::multiply(const BitMatrix &other) {
+    applyWordOperation(other, [](uint64_t n, uint64_t m) { return n & m; });
+    return *this;
+}
+
+BitMatrix BitMatrix::multiplyStatic(const BitMatrix &other) const {
+    BitMatrix result(*this);
+    result.multiply(other);
+    return result;
+}
+// endregion
+
+BitMatrix BitMatrix::product(const BitMatrix &other) const {
+    if (columns != other.rows) {
+        throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+    }
+
+    BitMatrix result(rows, other.columns);
+    const unsigned stride = other.wordsPerRow;
+    std::vector<uint64_t> table((std::size_t(1) << TABLE_BITS) * stride);
+
+    for (unsigned block = 0; block < columns; block += TABLE_BITS) {
+        const unsigned bits = std::min(TABLE_BITS, columns - block);
+
+        // table[g] is the sum of the rows block + b of the right operand for each bit b set in g. Each entry is
+        // built from a previous one by adding a single row.
+        for (unsigned g = 1; g < (1u << bits); ++g) {
+            unsigned lowestBit = 0;
+            while (((g >> lowestBit) & 1u) == 0) {
+                ++lowestBit;
+            }
+            const uint64_t *previous = table.data() + std::size_t(g & (g - 1)) * stride;
+            const uint64_t *row = other.rowWords(block + lowestBit);
+            uint64_t *entry = table.data() + std::size_t(g) * stride;
+            for (unsigned w = 0; w < stride; ++w) {
+                entry[w] = previous[w] ^ row[w];
+            }
+        }
+
+        // A block never crosses a word since WORD_BITS is a multiple of TABLE_BITS
+        const unsigned word = block / WORD_BITS, shift = block % WORD_BITS;
+        const uint64_t mask = (uint64_t(1) << bits) - 1;
+        for (unsigned i = 0; i < rows; ++i) {
+            const auto g = std::size_t((rowWords(i)[word] >> shift) & mask);
+            if (g != 0) {
+                const uint64_t *entry = table.data() + g * stride;
+                uint64_t *resultRow = result.rowWords(i);
+                for (unsigned w = 0; w < stride; ++w) {
+                    resultRow[w] ^= entry[w];
+                }
+            }
+        }
+    }
+    return result;
+}
+// endregion
+
+// region Operators
+
+std::ostream &operator<<(std::ostream &os, const BitMatrix &matrix) {
+    for (unsigned i = 0; i < matrix.rows; ++i) {
+        for (unsigned j = 0; j < matrix.columns; ++j) {
+            os << matrix.get(i, j) << " ";
+        }
+        os << std::endl;
+    }
+    return os;
+}
+
+BitMatrix operator+(const BitMatrix &lhs, const BitMatrix &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+BitMatrix operator-(const BitMatrix &lhs, const BitMatrix &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+BitMatrix operator*(const BitMatrix &lhs, const BitMatrix &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+// endregion
+
+// region Private Methods
+
+void BitMatrix::grow(unsigned newRows, unsigned newColumns) {
+    if (newRows == rows && newColumns == columns) {
+        return;
+    }
+
+    BitMatrix result(newRows, newColumns);
+    for (unsigned i = 0; i < rows; ++i) {
+        std::copy(rowWords(i), rowWords(i) + wordsPerRow, result.rowWords(i));
+    }
+    *this = std::move(result);
+}
+
+template<typename WordOperation>
+void BitMatrix::applyWordOperation(const BitMatrix &other, WordOperation op) {
+    grow(std::max(rows, other.rows), std::max(columns, other.columns));
+
+    // Words outside of the other matrix are 0
+    const unsigned commonWords = std::min(wordsPerRow, other.wordsPerRow);
+    for (unsigned i = 0; i < rows; ++i) {
+        uint64_t *row = rowWords(i);
+        if (i < other.rows) {
+            const uint64_t *otherRow = other.rowWords(i);
+            for (unsigned w = 0; w < commonWords; ++w) {
+                row[w] = op(row[w], otherRow[w]);
+            }
+        } else {
+            for (unsigned w = 0; w < commonWords; ++w) {
+                row[w] = op(row[w], 0);
+            }
+        }
+        for (unsigned w = commonWords; w < wordsPerRow; ++w) {
+            row[w] = op(row[w], 0);
+        }
+    }
+}
+// endregion
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class BitMatrix
+ * @brief Represents a matrix over GF(2), i.e. with elements stored modulo 2, packed as one bit per element.
+ * @authors Slimani Walid, Van Hove Timothée
+ * Each row is stored in 64 bits words, so 64 elements are processed at once: the addition and the subtraction are a
+ * XOR, the component by component multiplication is an AND. The matrix product uses the Method of Four Russians
+ * (M4RI). The semantics are the same as Matrix: an operand smaller than the other one is considered padded with zeros.
+ */
+class BitMatrix {
+private:
+    // region Fields
+    static constexpr unsigned WORD_BITS = 64;
+
+    // Number of rows of the right operand combined in each lookup table of the Four Russians product
+    static constexpr unsigned TABLE_BITS = 8;
+
+    unsigned rows, columns, wordsPerRow;
+
+    // Rows stored one after the other, the unused bits of the last word of a row are always 0
+    std::vector<uint64_t> words;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Gives a direct access to the words of a row.
+     * @param rowIndex The row index, must be lower than the number of rows.
+     * @return A pointer to the first word of the row.
+     */
+    [[nodiscard]] uint64_t *rowWords(unsigned rowIndex) { return words.data() + std::size_t(rowIndex) * wordsPerRow; }
+
+    /**
+     * @brief Gives a read-only access to the words of a row.
+     * @param rowIndex The row index, must be lower than the number of rows.
+     * @return A pointer to the first word of the row.
+     */
+    [[nodiscard]] const uint64_t *rowWords(unsigned rowIndex) const {
+        return words.data() + std::size_t(rowIndex) * wordsPerRow;
+    }
+
+    /**
+     * @brief Grows the matrix to the given size, the new elements are 0.
+     * @param newRows The new number of rows, must not be lower than the current one.
+     * @param newColumns The new number of columns, must not be lower than the current one.
+     */
+    void grow(unsigned newRows, unsigned newColumns);
+
+    /**
+     * @brief Applies a bitwise operation word by word with another matrix.
+     * @param other The other matrix to operate with.
+     * @param op The bitwise operation to apply on two words.
+     */
+    template<typename WordOperation>
+    void applyWordOperation(const BitMatrix &other, WordOperation op);
+
+    // endregion
+
+public:
+    // region Ctors
+    BitMatrix() = delete;
+
+    /**
+    * @brief Constructs a BitMatrix whose elements are all 0.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    */
+    BitMatrix(unsigned rows, unsigned columns);
+
+    /**
+    * @brief Constructs a BitMatrix holding the elements of a dense matrix.
+    * @param dense The dense matrix to convert, its modulo must be 2.
+    * @throws std::invalid_argument if the modulo of the dense matrix is not 2.
+    */
+    explicit BitMatrix(const Matrix &dense);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of rows of the matrix. */
+    [[nodiscard]] unsigned getRows() const { return rows; }
+
+    /** @return The number of columns of the matrix. */
+    [[nodiscard]] unsigned getColumns() const { return columns; }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    [[nodiscard]] bool get(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Sets the value of an element.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @param value The new value of the element.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    void set(unsigned rowIndex, unsigned columnIndex, bool value);
+
+    /**
+     * @brief Converts this matrix to a dense Matrix with a modulo of 2.
+     * @return The dense matrix holding the same elements.
+     */
+    [[nodiscard]] Matrix toMatrix() const;
+
+    /**
+     * @brief Adds another matrix to this matrix in-place (XOR).
+     * @param other The matrix to be added to this matrix.
+     * @return A reference to this matrix after the addition.
+     */
+    BitMatrix &add(const BitMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the result of adding another matrix to this matrix.
+     * @param other The matrix to be added to this matrix.
+     * @return A new BitMatrix instance that is the result of the addition.
+     */
+    [[nodiscard]] BitMatrix addStatic(const BitMatrix &other) const;
+
+    /**
+     * @brief Subtracts another matrix to this matrix in-place, which is the same as the addition in GF(2).
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A reference to this matrix after the subtraction.
+     */
+    BitMatrix &sub(const BitMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the result of subtracting another matrix to this matrix.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A new BitMatrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] BitMatrix subStatic(const BitMatrix &other) const;
+
+    /**
+     * @brief Multiplies (component by component) another matrix to this matrix in-place (AND).
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A reference to this matrix after the multiplication.
+     */
+    BitMatrix &multiply(const BitMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the component by component product of this matrix and another one.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A new BitMatrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] BitMatrix multiplyStatic(const BitMatrix &other) const;
+
+    /**
+     * @brief Computes the matrix product of this matrix with another one using the Method of Four Russians.
+     * The rows of the right operand are combined by groups of TABLE_BITS into a table of all their 2^TABLE_BITS sums,
+     * so each row of the result needs one table lookup per group instead of one row addition per element.
+     * @param other The right-hand side matrix, its number of rows must be the number of columns of this matrix.
+     * @return A new BitMatrix instance that is the result of the product.
+     * @throws std::invalid_argument if the inner dimensions are different.
+     */
+    [[nodiscard]] BitMatrix product(const BitMatrix &other) const;
+
+    // endregion
+
+    // region Operators
+
+    /**
+    * @brief Stream insertion operator for BitMatrix class.
+    * @param os The output stream to insert into.
+    * @param matrix The BitMatrix object to insert into the stream.
+    * @return A reference to the modified output stream.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const BitMatrix &matrix);
+    // endregion
+};
+
+/**
+ * @brief Adds two matrices over GF(2).
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of adding the two matrices.
+ */
+BitMatrix operator+(const BitMatrix &lhs, const BitMatrix &rhs);
+
+/**
+ * @brief Subtracts two matrices over GF(2).
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of subtracting the two matrices.
+ */
+BitMatrix operator-(const BitMatrix &lhs, const BitMatrix &rhs);
+
+/**
+ * @brief Multiplies two matrices over GF(2) component by component.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of multiplying the two matrices.
+ */
+BitMatrix operator*(const BitMatrix &lhs, const BitMatrix &rhs);
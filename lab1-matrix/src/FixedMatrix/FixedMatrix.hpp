@@ -0,0 +1,225 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <utility>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class FixedMatrix
+ * @brief Represents a matrix whose size is known at compile time, with elements stored modulo n.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The elements are stored inline in a std::array, so a FixedMatrix lives on the stack and needs no allocation.
+ * All the operations are constexpr and their loops are unrolled at compile time.
+ * @tparam R Number of rows in the matrix.
+ * @tparam C Number of columns in the matrix.
+ * @tparam Modulo The modulo value for matrix operations when it is known at compile time, 0 to give it at runtime.
+ */
+template<unsigned R, unsigned C, unsigned Modulo = 0>
+class FixedMatrix {
+    static_assert(R > 0 && C > 0, "A matrix must have at least one row and one column");
+
+    template<unsigned, unsigned, unsigned>
+    friend class FixedMatrix;
+
+private:
+    // region Fields
+    static constexpr std::size_t SIZE = std::size_t(R) * C;
+    using Indices = std::make_index_sequence<SIZE>;
+
+    std::array<unsigned, SIZE> data;
+    unsigned modulo;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Gets the modulo, as a constant when it is known at compile time so that the reductions are cheaper.
+     * @return The modulo.
+     */
+    [[nodiscard]] constexpr unsigned mod() const { return Modulo != 0 ? Modulo : modulo; }
+
+    /**
+     * @brief Checks that the modulo of another matrix is the same as the one of this matrix.
+     * @param otherModulo The modulo of the other matrix.
+     * @throws std::invalid_argument if the moduli are different.
+     */
+    constexpr void checkModulo(unsigned otherModulo) const;
+
+    /**
+     * @brief Applies an operation to each element of this matrix with the same element of another matrix.
+     * @param other The other matrix to operate with.
+     * @param op The modular operation to apply on two elements.
+     */
+    template<typename Operation, std::size_t... I>
+    constexpr void applyOperator(const FixedMatrix &other, Operation op, std::index_sequence<I...>);
+
+    /**
+     * @brief Computes one element of the matrix product.
+     * @param other The right-hand side matrix.
+     * @param row The row of the element.
+     * @param column The column of the element.
+     * @return The dot product of the row of this matrix and the column of the other matrix, reduced modulo n.
+     */
+    template<unsigned K, std::size_t... I>
+    [[nodiscard]] constexpr unsigned dot(const FixedMatrix<C, K, Modulo> &other, std::size_t row, std::size_t column,
+                                         std::index_sequence<I...>) const;
+
+    /**
+     * @brief Computes all the elements of the matrix product.
+     * @param other The right-hand side matrix.
+     * @param result The matrix receiving the product.
+     */
+    template<unsigned K, std::size_t... I>
+    constexpr void product(const FixedMatrix<C, K, Modulo> &other, FixedMatrix<R, K, Modulo> &result,
+                           std::index_sequence<I...>) const;
+
+    // endregion
+
+public:
+    // region Ctors
+
+    /**
+    * @brief Constructs a FixedMatrix whose elements are all 0.
+    * @param modulo The modulo value for matrix operations, defaults to the compile time modulo.
+    * @throws std::invalid_argument if the modulo is 0 or differs from the compile time modulo.
+    */
+    constexpr explicit FixedMatrix(unsigned modulo = Modulo);
+
+    /**
+    * @brief Constructs a FixedMatrix from its elements given row by row, the values are reduced modulo n.
+    * @param values The elements of the matrix.
+    * @param modulo The modulo value for matrix operations, defaults to the compile time modulo.
+    * @throws std::invalid_argument if the modulo is 0 or differs from the compile time modulo.
+    */
+    constexpr explicit FixedMatrix(const std::array<unsigned, SIZE> &values, unsigned modulo = Modulo);
+
+    /**
+    * @brief Constructs a FixedMatrix holding the elements of a dense matrix.
+    * @param dense The dense matrix to convert, it must have R rows and C columns.
+    * @throws std::invalid_argument if the size or the modulo of the dense matrix are not valid.
+    */
+    explicit FixedMatrix(const Matrix &dense);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of rows of the matrix. */
+    [[nodiscard]] static constexpr unsigned getRows() { return R; }
+
+    /** @return The number of columns of the matrix. */
+    [[nodiscard]] static constexpr unsigned getColumns() { return C; }
+
+    /** @return The modulo applied to the elements of the matrix. */
+    [[nodiscard]] constexpr unsigned getModulo() const { return mod(); }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    [[nodiscard]] constexpr unsigned get(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Sets the value of an element, the value is reduced modulo n.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @param value The new value of the element.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    constexpr void set(unsigned rowIndex, unsigned columnIndex, unsigned value);
+
+    /**
+     * @brief Converts this matrix to a dense Matrix.
+     * @return The dense matrix holding the same elements.
+     */
+    [[nodiscard]] Matrix toMatrix() const;
+
+    /**
+     * @brief Adds another matrix to this matrix in-place.
+     * @param other The matrix to be added to this matrix.
+     * @return A reference to this matrix after the addition.
+     */
+    constexpr FixedMatrix &add(const FixedMatrix &other);
+
+    /**
+     * @brief Subtracts another matrix to this matrix in-place.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A reference to this matrix after the subtraction.
+     */
+    constexpr FixedMatrix &sub(const FixedMatrix &other);
+
+    /**
+     * @brief Multiplies (component by component) another matrix to this matrix in-place.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A reference to this matrix after the multiplication.
+     */
+    constexpr FixedMatrix &multiply(const FixedMatrix &other);
+
+    /**
+     * @brief Computes the matrix product of this matrix with another one, the inner dimensions are checked at
+     * compile time.
+     * @param other The right-hand side matrix.
+     * @return A new FixedMatrix instance that is the result of the product.
+     * @throws std::invalid_argument if the moduli are different.
+     */
+    template<unsigned K>
+    [[nodiscard]] constexpr FixedMatrix<R, K, Modulo> product(const FixedMatrix<C, K, Modulo> &other) const;
+
+    // endregion
+
+    // region Operators
+
+    /**
+    * @brief Compares two matrices element by element.
+    * @param other The matrix to compare with.
+    * @return true if both matrices have the same modulo and elements, false otherwise.
+    */
+    constexpr bool operator==(const FixedMatrix &other) const;
+
+    /**
+    * @brief Adds two matrices.
+    * @param lhs The left-hand side matrix.
+    * @param rhs The right-hand side matrix.
+    * @return A new matrix that is the result of adding the two matrices.
+    */
+    friend constexpr FixedMatrix operator+(FixedMatrix lhs, const FixedMatrix &rhs) { return lhs.add(rhs); }
+
+    /**
+    * @brief Subtracts two matrices.
+    * @param lhs The left-hand side matrix.
+    * @param rhs The right-hand side matrix.
+    * @return A new matrix that is the result of subtracting the two matrices.
+    */
+    friend constexpr FixedMatrix operator-(FixedMatrix lhs, const FixedMatrix &rhs) { return lhs.sub(rhs); }
+
+    /**
+    * @brief Multiplies two matrices component by component.
+    * @param lhs The left-hand side matrix.
+    * @param rhs The right-hand side matrix.
+    * @return A new matrix that is the result of multiplying the two matrices.
+    */
+    friend constexpr FixedMatrix operator*(FixedMatrix lhs, const FixedMatrix &rhs) { return lhs.multiply(rhs); }
+
+    /**
+    * @brief Stream insertion operator for FixedMatrix class.
+    * @param os The output stream to insert into.
+    * @param matrix The FixedMatrix object to insert into the stream.
+    * @return A reference to the modified output stream.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const FixedMatrix &matrix) {
+        for (unsigned i = 0; i < R; ++i) {
+            for (unsigned j = 0; j < C; ++j) {
+                os << matrix.data[std::size_t(i) * C + j] << " ";
+            }
+            os << std::endl;
+        }
+        return os;
+    }
+    // endregion
+};
+
+#include "FixedMatrixImpl.hpp"
@@ -0,0 +1,160 @@
+#pragma once
+
+// This file is used to write the definition of the templated methods of FixedMatrix.hpp
+
+#include <cstdint>
+#include <stdexcept>
+#include "FixedMatrix.hpp"
+#include "../Utils/Modular.h"
+
+// region Constructors
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr FixedMatrix<R, C, Modulo>::FixedMatrix(unsigned modulo) : data{}, modulo(modulo) {
+    if (modulo < 1) {
+        throw std::invalid_argument("modulo cannot be zero or less");
+    }
+
+    if (Modulo != 0 && modulo != Modulo) {
+        throw std::invalid_argument("The modulo must be the one given at compile time");
+    }
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr FixedMatrix<R, C, Modulo>::FixedMatrix(const std::array<unsigned, SIZE> &values, unsigned modulo)
+        : FixedMatrix(modulo) {
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        data[i] = values[i] % mod();
+    }
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+FixedMatrix<R, C, Modulo>::FixedMatrix(const Matrix &dense) : FixedMatrix(dense.modulo) {
+    if (dense.rows != R || dense.columns != C) {
+        throw std::invalid_argument("The size of the matrix must be the size of the fixed matrix");
+    }
+
+    for (unsigned i = 0; i < R; ++i) {
+        const unsigned *row = dense.rowData(i);
+        for (unsigned j = 0; j < C; ++j) {
+            data[std::size_t(i) * C + j] = row[j];
+        }
+    }
+}
+// endregion
+
+// region Public Methods
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr unsigned FixedMatrix<R, C, Modulo>::get(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= R || columnIndex >= C) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    return data[std::size_t(rowIndex) * C + columnIndex];
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr void FixedMatrix<R, C, Modulo>::set(unsigned rowIndex, unsigned columnIndex, unsigned value) {
+    if (rowIndex >= R || columnIndex >= C) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    data[std::size_t(rowIndex) * C + columnIndex] = value % mod();
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+Matrix FixedMatrix<R, C, Modulo>::toMatrix() const {
+    Matrix result = Matrix::zeros(R, C, mod());
+    for (unsigned i = 0; i < R; ++i) {
+        unsigned *row = result.rowData(i);
+        for (unsigned j = 0; j < C; ++j) {
+            row[j] = data[std::size_t(i) * C + j];
+        }
+    }
+    return result;
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr FixedMatrix<R, C, Modulo> &FixedMatrix<R, C, Modulo>::add(const FixedMatrix &other) {
+    const unsigned m = mod();
+    applyOperator(other, [m](unsigned n, unsigned o) { return Modular::add(n, o, m); }, Indices());
+    return *this;
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr FixedMatrix<R, C, Modulo> &FixedMatrix<R, C, Modulo>::sub(const FixedMatrix &other) {
+    const unsigned m = mod();
+    applyOperator(other, [m](unsigned n, unsigned o) { return Modular::sub(n, o, m); }, Indices());
+    return *this;
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr FixedMatrix<R, C, Modulo> &FixedMatrix<R, C, Modulo>::multiply(const FixedMatrix &other) {
+    const unsigned m = mod();
+    applyOperator(other, [m](unsigned n, unsigned o) { return Modular::multiply(n, o, m); }, Indices());
+    return *this;
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+template<unsigned K>
+constexpr FixedMatrix<R, K, Modulo> FixedMatrix<R, C, Modulo>::product(const FixedMatrix<C, K, Modulo> &other) const {
+    checkModulo(other.mod());
+    FixedMatrix<R, K, Modulo> result(mod());
+    product(other, result, std::make_index_sequence<std::size_t(R) * K>());
+    return result;
+}
+// endregion
+
+// region Operators
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr bool FixedMatrix<R, C, Modulo>::operator==(const FixedMatrix &other) const {
+    if (mod() != other.mod()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        if (data[i] != other.data[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+// endregion
+
+// region Private Methods
+
+template<unsigned R, unsigned C, unsigned Modulo>
+constexpr void FixedMatrix<R, C, Modulo>::checkModulo(unsigned otherModulo) const {
+    if (otherModulo != mod()) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+template<typename Operation, std::size_t... I>
+constexpr void FixedMatrix<R, C, Modulo>::applyOperator(const FixedMatrix &other, Operation op,
+                                                        std::index_sequence<I...>) {
+    checkModulo(other.mod());
+
+    // One statement per element, no loop left at runtime
+    ((data[I] = op(data[I], other.data[I])), ...);
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+template<unsigned K, std::size_t... I>
+constexpr unsigned FixedMatrix<R, C, Modulo>::dot(const FixedMatrix<C, K, Modulo> &other, std::size_t row,
+                                                  std::size_t column, std::index_sequence<I...>) const {
+    const uint64_t m = mod();
+
+    // Each reduced product is lower than 2^32, so the C products can be summed without overflowing
+    const uint64_t sum = (uint64_t(0) + ... + (uint64_t(data[row * C + I]) * other.data[I * K + column] % m));
+    return unsigned(sum % m);
+}
+
+template<unsigned R, unsigned C, unsigned Modulo>
+template<unsigned K, std::size_t... I>
+constexpr void FixedMatrix<R, C, Modulo>::product(const FixedMatrix<C, K, Modulo> &other,
+                                                  FixedMatrix<R, K, Modulo> &result,
+                                                  std::index_sequence<I...>) const {
+    ((result.data[I] = dot(other, I / K, I % K, std::make_index_sequence<C>())), ...);
+}
+// endregion
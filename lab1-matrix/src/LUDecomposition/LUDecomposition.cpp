@@ -0,0 +1,278 @@
+#include "LUDecomposition.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include "../Utils/Modular.h"
+#include "../Utils/Parallel.h"
+#include "../Utils/Tuning.h"
+
+// region Constructors
+
+LUDecomposition::LUDecomposition(const Matrix &matrix)
+        : rows(matrix.rows), columns(matrix.columns), modulo(matrix.modulo) {
+    matrix.checkData();
+
+    if (!Modular::isPrime(modulo)) {
+        throw std::invalid_argument("The modulo must be prime to decompose the matrix");
+    }
+
+    lu.assign(matrix.data.data(), matrix.data.data() + matrix.data.size());
+    permutation.resize(rows);
+    std::iota(permutation.begin(), permutation.end(), 0u);
+
+    for (unsigned first = 0; first < columns && pivotColumns.size() < rows; first += PANEL) {
+        const unsigned last = std::min(columns, first + PANEL);
+        const std::size_t firstPivot = pivotColumns.size();
+        factorPanel(first, last);
+        updateTrailing(firstPivot, last);
+    }
+}
+// endregion
+
+// region Private methods
+
+void LUDecomposition::factorPanel(unsigned firstColumn, unsigned lastColumn) {
+    for (unsigned column = firstColumn; column < lastColumn && pivotColumns.size() < rows; ++column) {
+        const auto pivotRow = unsigned(pivotColumns.size());
+        unsigned row = pivotRow;
+        while (row < rows && at(row, column) == 0) {
+            ++row;
+        }
+        if (row == rows) {
+            continue;
+        }
+
+        // Whole rows are swapped, including their multipliers, so that the rows of L follow the permutation
+        if (row != pivotRow) {
+            std::swap_ranges(lu.begin() + std::ptrdiff_t(std::size_t(row) * columns),
+                             lu.begin() + std::ptrdiff_t(std::size_t(row + 1) * columns),
+                             lu.begin() + std::ptrdiff_t(std::size_t(pivotRow) * columns));
+            std::swap(permutation[row], permutation[pivotRow]);
+            oddPermutation = !oddPermutation;
+        }
+        pivotColumns.push_back(column);
+
+        // The pivot is inverted once, each row below only needs a product to get its multiplier
+        const unsigned inverse = Modular::inverse(at(pivotRow, column), modulo);
+        const unsigned *pivot = lu.data() + std::size_t(pivotRow) * columns;
+        const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::productGrain() / (lastColumn - column));
+        Parallel::forRange(pivotRow + 1, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+            for (std::size_t i = firstRow; i < lastRow; ++i) {
+                unsigned *target = lu.data() + i * columns;
+                if (target[column] == 0) {
+                    continue;
+                }
+                const unsigned factor = Modular::multiply(target[column], inverse, modulo);
+                target[column] = factor;
+                for (unsigned j = column + 1; j < lastColumn; ++j) {
+                    target[j] = Modular::sub(target[j], Modular::multiply(factor, pivot[j], modulo), modulo);
+                }
+            }
+        });
+    }
+}
+
+void LUDecomposition::updateTrailing(std::size_t firstPivot, unsigned firstColumn) {
+    const std::size_t lastPivot = pivotColumns.size();
+    if (firstPivot == lastPivot || firstColumn == columns) {
+        return;
+    }
+    const std::size_t count = lastPivot - firstPivot;
+
+    // Block of rows of the panel: forward substitution with the multipliers of the panel, the columns split across
+    // threads
+    const std::size_t columnGrain = std::max<std::size_t>(1, Tuning::productGrain() / (count * count));
+    Parallel::forRange(firstColumn, columns, columnGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = firstPivot + 1; t < lastPivot; ++t) {
+            unsigned *target = lu.data() + t * columns;
+            for (std::size_t u = firstPivot; u < t; ++u) {
+                const unsigned factor = target[pivotColumns[u]];
+                if (factor == 0) {
+                    continue;
+                }
+                const unsigned *source = lu.data() + u * columns;
+                for (std::size_t j = first; j < last; ++j) {
+                    target[j] = Modular::sub(target[j], Modular::multiply(factor, source[j], modulo), modulo);
+                }
+            }
+        }
+    });
+
+    // Rows below: product of their multipliers and the block of rows, one tile of the block at a time so that it is
+    // reused by all the rows of a thread
+    const unsigned *block = lu.data() + firstPivot * columns;
+    const uint64_t interval = Modular::reductionInterval(modulo);
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::productGrain() / (count * (columns - firstColumn)));
+    Parallel::forRange(lastPivot, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        std::vector<uint64_t> accumulators(TILE);
+        for (unsigned tile = firstColumn; tile < columns; tile += TILE) {
+            const unsigned width = std::min(TILE, columns - tile);
+            for (std::size_t i = firstRow; i < lastRow; ++i) {
+                unsigned *target = lu.data() + i * columns;
+                std::fill_n(accumulators.begin(), width, 0);
+                uint64_t pending = 0;
+                for (std::size_t u = 0; u < count; ++u) {
+                    const uint64_t factor = target[pivotColumns[firstPivot + u]];
+                    if (factor == 0) {
+                        continue;
+                    }
+                    const unsigned *source = block + u * columns + tile;
+                    for (unsigned j = 0; j < width; ++j) {
+                        accumulators[j] += factor * source[j];
+                    }
+                    if (++pending == interval) {
+                        for (unsigned j = 0; j < width; ++j) {
+                            accumulators[j] %= modulo;
+                        }
+                        pending = 0;
+                    }
+                }
+                for (unsigned j = 0; j < width; ++j) {
+                    target[tile + j] = Modular::sub(target[tile + j], unsigned(accumulators[j] % modulo), modulo);
+                }
+            }
+        }
+    });
+}
+
+void LUDecomposition::substitute(unsigned *elements, unsigned rhsColumns) const {
+    const unsigned n = rows;
+    const uint64_t interval = Modular::reductionInterval(modulo);
+    std::vector<unsigned> inverses(n);
+    for (unsigned i = 0; i < n; ++i) {
+        inverses[i] = Modular::inverse(at(i, i), modulo);
+    }
+
+    // The columns of B are independent systems, each thread solves some of them one tile at a time
+    const std::size_t columnGrain = std::max<std::size_t>(1, Tuning::productGrain() / (std::size_t(n) * n));
+    Parallel::forRange(0, rhsColumns, columnGrain, [&](std::size_t first, std::size_t last) {
+        std::vector<uint64_t> accumulators(TILE);
+        for (std::size_t tile = first; tile < last; tile += TILE) {
+            const auto width = unsigned(std::min<std::size_t>(TILE, last - tile));
+
+            // Row i of X: (B_i - sum of the factors of row i times the rows already solved) / pivot
+            auto solveRow = [&](unsigned i, unsigned firstSolved, unsigned lastSolved, unsigned inverse) {
+                std::fill_n(accumulators.begin(), width, 0);
+                uint64_t pending = 0;
+                for (unsigned t = firstSolved; t < lastSolved; ++t) {
+                    const uint64_t factor = at(i, t);
+                    if (factor == 0) {
+                        continue;
+                    }
+                    const unsigned *source = elements + std::size_t(t) * rhsColumns + tile;
+                    for (unsigned j = 0; j < width; ++j) {
+                        accumulators[j] += factor * source[j];
+                    }
+                    if (++pending == interval) {
+                        for (unsigned j = 0; j < width; ++j) {
+                            accumulators[j] %= modulo;
+                        }
+                        pending = 0;
+                    }
+                }
+                unsigned *target = elements + std::size_t(i) * rhsColumns + tile;
+                for (unsigned j = 0; j < width; ++j) {
+                    const unsigned value = Modular::sub(target[j], unsigned(accumulators[j] % modulo), modulo);
+                    target[j] = Modular::multiply(value, inverse, modulo);
+                }
+            };
+
+            // L has a unit diagonal, U is solved from the last row
+            for (unsigned i = 0; i < n; ++i) {
+                solveRow(i, 0, i, 1 % modulo);
+            }
+            for (unsigned i = n; i-- > 0;) {
+                solveRow(i, i + 1, n, inverses[i]);
+            }
+        }
+    });
+}
+
+void LUDecomposition::checkSquare() const {
+    if (rows != columns) {
+        throw std::invalid_argument("The matrix must be square");
+    }
+}
+
+void LUDecomposition::checkInvertible() const {
+    checkSquare();
+    if (getRank() != rows) {
+        throw std::runtime_error("The matrix is singular");
+    }
+}
+// endregion
+
+// region Public methods
+
+Matrix LUDecomposition::getLower() const {
+    Matrix lower = Matrix::zeros(rows, rows, modulo);
+    unsigned *elements = lower.data.mutableData();
+    for (unsigned i = 0; i < rows; ++i) {
+        for (unsigned t = 0; t < std::min(i, getRank()); ++t) {
+            elements[std::size_t(i) * rows + t] = at(i, pivotColumns[t]);
+        }
+        elements[std::size_t(i) * rows + i] = 1 % modulo;
+    }
+    return lower;
+}
+
+Matrix LUDecomposition::getUpper() const {
+    Matrix upper = Matrix::zeros(rows, columns, modulo);
+    unsigned *elements = upper.data.mutableData();
+    for (unsigned i = 0; i < getRank(); ++i) {
+        for (unsigned j = pivotColumns[i]; j < columns; ++j) {
+            elements[std::size_t(i) * columns + j] = at(i, j);
+        }
+    }
+    return upper;
+}
+
+unsigned LUDecomposition::determinant() const {
+    checkSquare();
+    if (getRank() != rows) {
+        return 0;
+    }
+
+    unsigned result = 1 % modulo;
+    for (unsigned i = 0; i < rows; ++i) {
+        result = Modular::multiply(result, at(i, i), modulo);
+    }
+    return oddPermutation ? Modular::sub(0, result, modulo) : result;
+}
+
+Matrix LUDecomposition::inverse() const {
+    checkInvertible();
+
+    // Solves A * X = I, the rows of I being permuted like the rows of A
+    Matrix result = Matrix::zeros(rows, rows, modulo);
+    unsigned *elements = result.data.mutableData();
+    for (unsigned i = 0; i < rows; ++i) {
+        elements[std::size_t(i) * rows + permutation[i]] = 1 % modulo;
+    }
+    substitute(elements, rows);
+    return result;
+}
+
+Matrix LUDecomposition::solve(const Matrix &rhs) const {
+    checkInvertible();
+    rhs.checkData();
+
+    if (rhs.modulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+
+    if (rhs.rows != rows) {
+        throw std::invalid_argument("The number of rows of the right-hand side must be the number of rows of the matrix");
+    }
+
+    Matrix result = Matrix::zeros(rows, rhs.columns, modulo);
+    unsigned *elements = result.data.mutableData();
+    for (unsigned i = 0; i < rows; ++i) {
+        const unsigned *row = rhs.rowData(permutation[i]);
+        std::copy(row, row + rhs.columns, elements + std::size_t(i) * rhs.columns);
+    }
+    substitute(elements, rhs.columns);
+    return result;
+}
+// endregion
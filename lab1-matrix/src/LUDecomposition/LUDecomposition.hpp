@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class LUDecomposition
+ * @brief Represents the decomposition P * A = L * U of a matrix modulo a prime p, used to get its rank, determinant
+ * and inverse and to solve linear systems.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The elimination is blocked: the pivots of a panel of PANEL columns are searched and applied to the panel only, with
+ * a single modular inverse per pivot. The block of rows of the panel is then solved and the rest of the matrix is
+ * updated at once by a tiled product of the panel and the block of rows, with 64 bits accumulators reduced only when
+ * they could overflow and the rows split across threads, so most of the work is done in the product.
+ * Every non-zero element is a valid pivot in GF(p). A column without pivot is skipped, so any matrix can be decomposed
+ * and U is in row echelon form.
+ */
+class LUDecomposition {
+private:
+    // region Fields
+
+    // Number of columns eliminated before the rest of the matrix is updated
+    static constexpr unsigned PANEL = 64;
+
+    // Number of columns of the rest of the matrix updated together, so that a tile of the block of rows stays in cache
+    static constexpr unsigned TILE = 256;
+
+    unsigned rows, columns, modulo;
+
+    // L (without its unit diagonal, stored in the pivot columns) and U, row after row
+    std::vector<unsigned> lu;
+
+    // The row i of L * U is the row permutation[i] of the matrix
+    std::vector<unsigned> permutation;
+
+    // Column of the pivot of each row of U, their number is the rank
+    std::vector<unsigned> pivotColumns;
+
+    // Whether the permutation is made of an odd number of swaps
+    bool oddPermutation = false;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Eliminates the columns of a panel, the pivot rows are swapped with the first rows without pivot.
+     * @param firstColumn The first column of the panel.
+     * @param lastColumn The column after the last one of the panel.
+     */
+    void factorPanel(unsigned firstColumn, unsigned lastColumn);
+
+    /**
+     * @brief Applies the pivots of a panel to the columns at its right: solves its block of rows, then subtracts the
+     * product of the panel and the block of rows from the rows below.
+     * @param firstPivot The first pivot found in the panel.
+     * @param firstColumn The first column at the right of the panel.
+     */
+    void updateTrailing(std::size_t firstPivot, unsigned firstColumn);
+
+    /**
+     * @brief Solves L * U * X = B in-place, the rows of B being already permuted.
+     * @param elements The elements of B, row after row.
+     * @param rhsColumns The number of columns of B.
+     */
+    void substitute(unsigned *elements, unsigned rhsColumns) const;
+
+    /**
+     * @brief Checks that the matrix is square.
+     * @throws std::invalid_argument if the matrix is not square.
+     */
+    void checkSquare() const;
+
+    /**
+     * @brief Checks that the matrix is invertible.
+     * @throws std::invalid_argument if the matrix is not square.
+     * @throws std::runtime_error if the matrix is singular.
+     */
+    void checkInvertible() const;
+
+    /**
+     * @brief Gets an element of the decomposition.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The element.
+     */
+    [[nodiscard]] unsigned at(unsigned rowIndex, unsigned columnIndex) const {
+        return lu[std::size_t(rowIndex) * columns + columnIndex];
+    }
+
+    // endregion
+
+public:
+    // region Ctors
+    LUDecomposition() = delete;
+
+    /**
+     * @brief Decomposes a matrix.
+     * @param matrix The matrix to decompose, its modulo must be prime.
+     * @throws std::invalid_argument if the modulo is not prime.
+     * @throws std::runtime_error if the data of the matrix is null.
+     */
+    explicit LUDecomposition(const Matrix &matrix);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of rows of the decomposed matrix. */
+    [[nodiscard]] unsigned getRows() const { return rows; }
+
+    /** @return The number of columns of the decomposed matrix. */
+    [[nodiscard]] unsigned getColumns() const { return columns; }
+
+    /** @return The modulo of the decomposed matrix. */
+    [[nodiscard]] unsigned getModulo() const { return modulo; }
+
+    /** @return The rank of the decomposed matrix. */
+    [[nodiscard]] unsigned getRank() const { return unsigned(pivotColumns.size()); }
+
+    /** @return The row of the decomposed matrix found at each row of L * U. */
+    [[nodiscard]] const std::vector<unsigned> &getPermutation() const { return permutation; }
+
+    /** @return The unit lower triangular matrix L, rows x rows. */
+    [[nodiscard]] Matrix getLower() const;
+
+    /** @return The upper matrix U in row echelon form, rows x columns. */
+    [[nodiscard]] Matrix getUpper() const;
+
+    /**
+     * @brief Computes the determinant of the decomposed matrix, the signed product of the pivots.
+     * @return The determinant modulo p.
+     * @throws std::invalid_argument if the matrix is not square.
+     */
+    [[nodiscard]] unsigned determinant() const;
+
+    /**
+     * @brief Computes the inverse of the decomposed matrix.
+     * @return A new Matrix instance that is the inverse.
+     * @throws std::invalid_argument if the matrix is not square.
+     * @throws std::runtime_error if the matrix is singular.
+     */
+    [[nodiscard]] Matrix inverse() const;
+
+    /**
+     * @brief Solves the linear systems A * X = B, one for each column of B.
+     * @param rhs The right-hand sides B.
+     * @return A new Matrix instance that is the solution X.
+     * @throws std::invalid_argument if the matrix is not square, or the modulo or the number of rows of B are different.
+     * @throws std::runtime_error if the matrix is singular or the data of B is null.
+     */
+    [[nodiscard]] Matrix solve(const Matrix &rhs) const;
+
+    // endregion
+};
@@ -0,0 +1,177 @@
+#include "MaintainedResult.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../Utils/Modular.h"
+#include "../Utils/Parallel.h"
+#include "../Utils/Tuning.h"
+
+// region Constructors
+
+// The 1 x 1 result is replaced by the complete computation
+MaintainedResult::MaintainedResult(Matrix &lhs, Matrix &rhs, Operation operation)
+        : lhs(lhs), rhs(rhs), operation(operation), result(Matrix::zeros(1, 1, 1)),
+          lhsRows(0), lhsColumns(0), rhsRows(0), rhsColumns(0), lhsGeneration(0), rhsGeneration(0) {
+    computeAll();
+}
+// endregion
+
+// region Public Methods
+
+std::size_t MaintainedResult::update() {
+    const Matrix::Region dimensions = resultDimensions();
+    if (lhs.rows != lhsRows || lhs.columns != lhsColumns || rhs.rows != rhsRows || rhs.columns != rhsColumns ||
+        result.rows != dimensions.lastRow || result.columns != dimensions.lastColumn || result.modulo != lhs.modulo) {
+        return computeAll();
+    }
+
+    std::size_t computed = 0;
+    auto recompute = [this, &computed](const Matrix::Region &region) {
+        if (region.firstRow < region.lastRow && region.firstColumn < region.lastColumn) {
+            computeRegion(region);
+            computed += std::size_t(region.lastRow - region.firstRow) * (region.lastColumn - region.firstColumn);
+        }
+    };
+
+    // An element-wise result depends on the same region, a product on the same rows of the left operand and the same
+    // columns of the right one
+    const bool product = operation == Operation::Product;
+    const std::vector<Matrix::Region> lhsRegions = lhs.getDirtyRegions(lhsGeneration);
+    for (const Matrix::Region &region: lhsRegions) {
+        recompute(product ? Matrix::Region{region.firstRow, region.lastRow, 0, result.columns} : region);
+    }
+    if (&rhs != &lhs) {
+        for (const Matrix::Region &region: rhs.getDirtyRegions(rhsGeneration)) {
+            recompute(product ? Matrix::Region{0, result.rows, region.firstColumn, region.lastColumn} : region);
+        }
+    } else if (product) {
+        // The same matrix on both sides, its dirty columns also change the product
+        for (const Matrix::Region &region: lhsRegions) {
+            recompute({0, result.rows, region.firstColumn, region.lastColumn});
+        }
+    }
+
+    lhsGeneration = lhs.getGeneration();
+    rhsGeneration = rhs.getGeneration();
+    return computed;
+}
+
+const Matrix &MaintainedResult::get() {
+    update();
+    return result;
+}
+// endregion
+
+// region Private Methods
+
+Matrix::Region MaintainedResult::resultDimensions() const {
+    lhs.checkData();
+    rhs.checkData();
+    if (lhs.modulo != rhs.modulo) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+
+    if (operation == Operation::Product) {
+        if (lhs.columns != rhs.rows) {
+            throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+        }
+        return {0, lhs.rows, 0, rhs.columns};
+    }
+    return {0, std::max(lhs.rows, rhs.rows), 0, std::max(lhs.columns, rhs.columns)};
+}
+
+std::size_t MaintainedResult::computeAll() {
+    const Matrix::Region dimensions = resultDimensions();
+    if (result.rows != dimensions.lastRow || result.columns != dimensions.lastColumn || result.modulo != lhs.modulo) {
+        result = Matrix::zeros(dimensions.lastRow, dimensions.lastColumn, lhs.modulo);
+    }
+    computeRegion(dimensions);
+
+    lhsRows = lhs.rows;
+    lhsColumns = lhs.columns;
+    rhsRows = rhs.rows;
+    rhsColumns = rhs.columns;
+    lhsGeneration = lhs.getGeneration();
+    rhsGeneration = rhs.getGeneration();
+    return std::size_t(result.rows) * result.columns;
+}
+
+void MaintainedResult::computeRegion(const Matrix::Region &region) {
+    const unsigned n = lhs.modulo;
+    switch (operation) {
+        case Operation::Add:
+            computeElements(region, [n](unsigned a, unsigned b) { return Modular::add(a, b, n); });
+            break;
+        case Operation::Sub:
+            computeElements(region, [n](unsigned a, unsigned b) { return Modular::sub(a, b, n); });
+            break;
+        case Operation::Multiply:
+            computeElements(region, [n](unsigned a, unsigned b) { return Modular::multiply(a, b, n); });
+            break;
+        case Operation::Product:
+            computeProduct(region);
+            break;
+    }
+}
+
+template<typename ElementFunction>
+void MaintainedResult::computeElements(const Matrix::Region &region, ElementFunction op) {
+    // The operands are only read, through their const accessors that do not duplicate shared elements
+    const Matrix &left = lhs, &right = rhs;
+    unsigned *elements = result.data.mutableData();
+    const unsigned width = region.lastColumn - region.firstColumn;
+
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / width);
+    Parallel::forRange(region.firstRow, region.lastRow, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        for (auto i = unsigned(firstRow); i < lastRow; ++i) {
+            unsigned *resultRow = elements + std::size_t(i) * result.columns;
+
+            // The elements outside of an operand are 0
+            const unsigned *leftRow = i < left.rows ? left.rowData(i) : nullptr;
+            const unsigned *rightRow = i < right.rows ? right.rowData(i) : nullptr;
+            const unsigned leftEnd = leftRow ? left.columns : 0, rightEnd = rightRow ? right.columns : 0;
+            for (unsigned j = region.firstColumn; j < region.lastColumn; ++j) {
+                resultRow[j] = op(j < leftEnd ? leftRow[j] : 0, j < rightEnd ? rightRow[j] : 0);
+            }
+        }
+    });
+}
+
+void MaintainedResult::computeProduct(const Matrix::Region &region) {
+    const Matrix &left = lhs, &right = rhs;
+    unsigned *elements = result.data.mutableData();
+    const unsigned n = left.modulo, width = region.lastColumn - region.firstColumn;
+    const uint64_t interval = Modular::reductionInterval(n);
+
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::productGrain() / (std::size_t(width) * left.columns));
+    Parallel::forRange(region.firstRow, region.lastRow, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        std::vector<uint64_t> accumulators(width);
+        for (auto i = unsigned(firstRow); i < lastRow; ++i) {
+            std::fill(accumulators.begin(), accumulators.end(), 0);
+            uint64_t pending = 0;
+
+            // The columns of the region of the rows of the right operand, scaled by the row of the left one
+            const unsigned *row = left.rowData(i);
+            for (unsigned k = 0; k < left.columns; ++k) {
+                const uint64_t value = row[k];
+                const unsigned *rightRow = right.rowData(k) + region.firstColumn;
+                for (unsigned j = 0; j < width; ++j) {
+                    accumulators[j] += value * rightRow[j];
+                }
+                if (++pending == interval) {
+                    for (uint64_t &accumulator: accumulators) {
+                        accumulator %= n;
+                    }
+                    pending = 0;
+                }
+            }
+
+            unsigned *resultRow = elements + std::size_t(i) * result.columns + region.firstColumn;
+            for (unsigned j = 0; j < width; ++j) {
+                resultRow[j] = unsigned(accumulators[j] % n);
+            }
+        }
+    });
+}
+// endregion
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class MaintainedResult
+ * @brief Keeps the result of an operation between two matrices up to date, by recomputing only the elements that
+ * depend on the regions of the operands written since the generations of the last update (see Matrix::getDirtyRegions).
+ * @authors Slimani Walid, Van Hove Timothée
+ * For the element-wise operations, an element of the result only depends on the elements at the same position, so a
+ * dirty region costs its area: updating a single element of an operand is O(1). For the matrix product, a dirty region
+ * of the left operand changes whole rows of the result, and a dirty region of the right operand whole columns.
+ * The operands are referenced, not copied: they must outlive this object. Each maintained result keeps the generations
+ * of the operands it last read and never modifies them, so an operand can be shared by several maintained results.
+ */
+class MaintainedResult {
+public:
+    /** @brief The maintained operations. */
+    enum class Operation {
+        Add,      // Matrix addition, as operator+
+        Sub,      // Matrix subtraction, as operator-
+        Multiply, // Component by component multiplication, as operator*
+        Product   // Matrix product, as Matrix::product
+    };
+
+private:
+    // region Fields
+
+    Matrix &lhs, &rhs;
+    Operation operation;
+    Matrix result;
+
+    // Dimensions of the operands when the result was last computed, a change needs a complete computation
+    unsigned lhsRows, lhsColumns, rhsRows, rhsColumns;
+    // Generations of the operands the result is up to date with
+    uint64_t lhsGeneration, rhsGeneration;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Checks the operands and gets the dimensions of the result.
+     * @return The number of rows and columns of the result.
+     * @throws std::invalid_argument if the moduli or the dimensions of the operands do not match.
+     */
+    [[nodiscard]] Matrix::Region resultDimensions() const;
+
+    /**
+     * @brief Computes the elements of a region of the result from the operands.
+     * @param region The region, within the result.
+     */
+    void computeRegion(const Matrix::Region &region);
+
+    /**
+     * @brief Computes the elements of a region of the result of an element-wise operation, the rows in parallel.
+     * @param region The region, within the result.
+     * @param op The function computing an element from the elements of the operands (0 outside of an operand).
+     */
+    template<typename ElementFunction>
+    void computeElements(const Matrix::Region &region, ElementFunction op);
+
+    /**
+     * @brief Computes the elements of a region of the product, the rows in parallel.
+     * @param region The region, within the result.
+     */
+    void computeProduct(const Matrix::Region &region);
+
+    /**
+     * @brief Computes the whole result and records the generations of the operands.
+     * @return The number of elements computed.
+     */
+    std::size_t computeAll();
+
+    // endregion
+
+public:
+    // region Ctors
+    MaintainedResult() = delete;
+
+    /**
+     * @brief Computes the result of an operation, kept up to date with the operands by update().
+     * @param lhs The left-hand side matrix.
+     * @param rhs The right-hand side matrix.
+     * @param operation The operation.
+     * @throws std::invalid_argument if the moduli are different, or the inner dimensions of a product.
+     */
+    MaintainedResult(Matrix &lhs, Matrix &rhs, Operation operation);
+
+    MaintainedResult(const MaintainedResult &) = delete;
+
+    MaintainedResult &operator=(const MaintainedResult &) = delete;
+    // endregion
+
+    // region Public methods
+
+    /**
+     * @brief Recomputes the elements of the result depending on the dirty regions of the operands, or the whole result
+     * if the dimensions of an operand changed, then records the generations of the operands.
+     * @return The number of elements of the result recomputed.
+     * @throws std::invalid_argument if the operands no longer match.
+     */
+    std::size_t update();
+
+    /**
+     * @brief Gets the result, updated first.
+     * @return The result of the operation on the current operands.
+     * @throws std::invalid_argument if the operands no longer match.
+     */
+    const Matrix &get();
+
+    // endregion
+};
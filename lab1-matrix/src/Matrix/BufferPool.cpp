@@ -0,0 +1,117 @@
+#include "BufferPool.hpp"
+
+// region Ctors and Destructor
+
+BufferPool::BufferPool(std::size_t maxCachedBytes, std::pmr::memory_resource *upstream)
+        : upstream(upstream), maxCachedBytes(maxCachedBytes) {}
+
+BufferPool::~BufferPool() {
+    release();
+}
+// endregion
+
+// region Public methods
+
+BufferPool &BufferPool::local() {
+    thread_local BufferPool pool;
+    return pool;
+}
+
+BufferPool::Stats BufferPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void BufferPool::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.hits = 0;
+    stats.misses = 0;
+}
+
+void BufferPool::release() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (std::size_t index = 0; index < freeLists.size(); ++index) {
+        for (void *buffer: freeLists[index]) {
+            upstream->deallocate(buffer, classSize(index), MIN_CLASS_SIZE);
+        }
+        freeLists[index].clear();
+    }
+    stats.cachedBytes = 0;
+}
+// endregion
+
+// region memory_resource
+
+void *BufferPool::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // The cached buffers are aligned on MIN_CLASS_SIZE, a stricter alignment is not pooled
+    if (alignment > MIN_CLASS_SIZE) {
+        return upstream->allocate(bytes, alignment);
+    }
+
+    const std::size_t index = classIndex(bytes);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (index < freeLists.size() && !freeLists[index].empty()) {
+            void *buffer = freeLists[index].back();
+            freeLists[index].pop_back();
+            stats.cachedBytes -= classSize(index);
+            ++stats.hits;
+            return buffer;
+        }
+        ++stats.misses;
+    }
+    return upstream->allocate(classSize(index), MIN_CLASS_SIZE);
+}
+
+void BufferPool::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) {
+    if (alignment > MIN_CLASS_SIZE) {
+        upstream->deallocate(pointer, bytes, alignment);
+        return;
+    }
+
+    const std::size_t index = classIndex(bytes), size = classSize(index);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stats.cachedBytes + size <= maxCachedBytes) {
+            if (index >= freeLists.size()) {
+                freeLists.resize(index + 1);
+            }
+            freeLists[index].push_back(pointer);
+            stats.cachedBytes += size;
+            return;
+        }
+    }
+    upstream->deallocate(pointer, size, MIN_CLASS_SIZE);
+}
+
+bool BufferPool::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+// endregion
+
+// region Private methods
+
+std::size_t BufferPool::classIndex(std::size_t bytes) {
+    if (bytes <= MIN_CLASS_SIZE) {
+        return 0;
+    }
+
+    // Find the power of two such that power < bytes <= 2 * power, then the quarter of it holding the size
+    std::size_t power = MIN_CLASS_SIZE, exponent = 0;
+    while (bytes - 1 >= power * 2) {
+        power *= 2;
+        ++exponent;
+    }
+    const std::size_t step = power / CLASSES_PER_POWER;
+    return exponent * CLASSES_PER_POWER + (bytes - power + step - 1) / step;
+}
+
+std::size_t BufferPool::classSize(std::size_t index) {
+    if (index == 0) {
+        return MIN_CLASS_SIZE;
+    }
+
+    const std::size_t power = MIN_CLASS_SIZE << ((index - 1) / CLASSES_PER_POWER);
+    return power + ((index - 1) % CLASSES_PER_POWER + 1) * (power / CLASSES_PER_POWER);
+}
+// endregion
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class BufferPool
+ * @brief Memory resource keeping the freed buffers in size classes to give them back to the next allocations.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The sizes are rounded up to a class (4 classes per power of two, so at most 25% of the memory is lost) and a freed
+ * buffer is kept in the free list of its class, up to a maximum number of cached bytes. An allocation of the same
+ * class then reuses it without calling the upstream resource. The pool is thread-safe, but each thread can use its own
+ * pool with local() to avoid sharing the lock.
+ */
+class BufferPool : public std::pmr::memory_resource {
+public:
+    /** @brief Counters of the allocations served by the pool. */
+    struct Stats {
+        std::size_t hits;        // Allocations served by a cached buffer
+        std::size_t misses;      // Allocations forwarded to the upstream resource
+        std::size_t cachedBytes; // Bytes currently kept in the free lists
+
+        /** @return The ratio of the allocations served by a cached buffer, 0 if nothing was allocated. */
+        [[nodiscard]] double hitRate() const {
+            return hits + misses == 0 ? 0.0 : double(hits) / double(hits + misses);
+        }
+    };
+
+    // Default maximum number of bytes kept in the free lists
+    static constexpr std::size_t DEFAULT_MAX_CACHED_BYTES = std::size_t(64) << 20;
+
+    // region Ctors and Destructor
+
+    /**
+     * @brief Constructs an empty pool.
+     * @param maxCachedBytes The maximum number of bytes kept in the free lists, the buffers freed beyond are given
+     * back to the upstream resource.
+     * @param upstream The resource providing the memory of the pool.
+     */
+    explicit BufferPool(std::size_t maxCachedBytes = DEFAULT_MAX_CACHED_BYTES,
+                        std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+
+    BufferPool(const BufferPool &) = delete;
+
+    BufferPool &operator=(const BufferPool &) = delete;
+
+    /** @brief Destructor that gives the cached buffers back to the upstream resource. */
+    ~BufferPool() override;
+    // endregion
+
+    // region Public methods
+
+    /**
+     * @brief Gets the pool of the calling thread, created on its first use.
+     * @note The pool is destroyed when the thread exits: the buffers allocated from it must be freed before.
+     * @return The pool of the calling thread.
+     */
+    static BufferPool &local();
+
+    /** @return The current counters of the pool. */
+    [[nodiscard]] Stats getStats() const;
+
+    /** @brief Sets the hit and miss counters to 0. */
+    void resetStats();
+
+    /** @brief Gives all the cached buffers back to the upstream resource. */
+    void release();
+    // endregion
+
+protected:
+    // region memory_resource
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+    // endregion
+
+private:
+    // Size of the smallest class and alignment of all the cached buffers
+    static constexpr std::size_t MIN_CLASS_SIZE = 64;
+    static constexpr std::size_t CLASSES_PER_POWER = 4;
+
+    std::pmr::memory_resource *upstream;
+    const std::size_t maxCachedBytes;
+    std::vector<std::vector<void *>> freeLists;
+    Stats stats{};
+    mutable std::mutex mutex;
+
+    /**
+     * @brief Gets the class of a size.
+     * @param bytes The size in bytes.
+     * @return The index of the smallest class holding the size.
+     */
+    static std::size_t classIndex(std::size_t bytes);
+
+    /**
+     * @brief Gets the size of the buffers of a class.
+     * @param index The index of the class.
+     * @return The size in bytes.
+     */
+    static std::size_t classSize(std::size_t index);
+};
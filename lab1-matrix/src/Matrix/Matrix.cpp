@@ -1,15 +1,32 @@
 #include "Matrix.hpp"
-#include <cstring>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 #include "../Utils/Utils.h"
-#include "../Operators/Add/Add.h"
-#include "../Operators/Sub/Sub.h"
-#include "../Operators/Multiply/Multiply.h"
+#include "../Utils/Parallel.h"
+#include "../Utils/Modular.h"
+#include "../Utils/Montgomery.h"
+#include "../Utils/Transpose.h"
+#include "../Utils/Tuning.h"
+#include "../LUDecomposition/LUDecomposition.hpp"
+#include "../Vector/Vector.hpp"
 
 // region Constructors and Destructor
 
-Matrix::Matrix(unsigned rows, unsigned columns, unsigned modulo) : rows(rows), columns(columns),
-                                                                   modulo(modulo) {
+Matrix::Matrix(unsigned rows, unsigned columns, unsigned modulo)
+        : Matrix(rows, columns, modulo, Fill::Random, std::pmr::get_default_resource()) {}
+
+Matrix::Matrix(unsigned rows, unsigned columns, unsigned modulo, std::pmr::memory_resource *resource)
+        : Matrix(rows, columns, modulo, Fill::Random, resource) {}
+
+Matrix::Matrix(unsigned rows, unsigned columns, unsigned modulo, Fill fill, std::pmr::memory_resource *resource)
+        : rows(rows), columns(columns), modulo(modulo) {
     if (modulo < 1) {
         throw std::invalid_argument("modulo cannot be zero or less");
     }
@@ -22,64 +39,111 @@ Matrix::Matrix(unsigned rows, unsigned columns, unsigned modulo) : rows(rows), c
         throw std::runtime_error("columns cannot be less than 1");
     }
 
-    try {
-        data = new unsigned *[rows];
-        for (unsigned i = 0; i < rows; ++i) {
-            data[i] = new unsigned[columns];
-            for (unsigned j = 0; j < columns; ++j) {
-                data[i][j] = Utils::getRandom(modulo);
+    data = SharedBuffer(std::size_t(rows) * columns, resource);
+    if (fill == Fill::None) {
+        return;
+    }
+    unsigned *elements = data.mutableData();
+
+    // The first write places the pages: the rows are split like in the element-wise kernels, so with pinned threads
+    // (see Parallel::setPinning) each chunk of rows is on the node of the thread that processes it. Each random element
+    // is drawn from its position in a stream, a seeded matrix is the same whatever the number of threads.
+    const uint64_t seed = fill == Fill::Random ? Utils::getRandomSeed() : 0;
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / columns);
+    Parallel::forRange(0, rows, rowGrain, [this, elements, fill, seed](std::size_t firstRow, std::size_t lastRow) {
+        const std::size_t first = firstRow * this->columns, last = lastRow * this->columns;
+        if (fill == Fill::Random) {
+            for (std::size_t i = first; i < last; ++i) {
+                elements[i] = Utils::getRandom(seed, i, this->modulo);
             }
+        } else {
+            std::fill(elements + first, elements + last, EMPTY_CASE);
         }
-    } catch (...) {
-        freeMemory(data, this->rows, this->columns);
-        throw;
-    }
+    });
 }
 
-Matrix::Matrix(const Matrix &other) : rows(other.rows), columns(other.columns),
-                                      modulo(other.modulo) {
-
-    data = copyData(other);
-}
+Matrix::Matrix(const Matrix &other) : data(other.copyOnWrite ? other.data : other.data.clone()),
+                                      rows(other.rows), columns(other.columns), modulo(other.modulo),
+                                      copyOnWrite(other.copyOnWrite) {}
 
 Matrix::Matrix(Matrix &&other) noexcept:
-        data{std::exchange(other.data, nullptr)},
+        data{std::move(other.data)},
         rows{std::exchange(other.rows, 0)},
         columns{std::exchange(other.columns, 0)},
-        modulo{std::exchange(other.modulo, 0)} {}
+        modulo{std::exchange(other.modulo, 0)},
+        copyOnWrite{other.copyOnWrite} {}
 
-Matrix::~Matrix() {
-    freeMemory(data, rows, columns);
+Matrix::~Matrix() = default;
+
+Matrix Matrix::zeros(unsigned rows, unsigned columns, unsigned modulo, std::pmr::memory_resource *resource) {
+    return {rows, columns, modulo, Fill::Zero, resource};
 }
 
-unsigned **Matrix::copyData(const Matrix &other) {
-    unsigned** result;
-    try{
-        result = new unsigned *[rows];
-        for (unsigned i = 0; i < rows; ++i) {
-            result[i] = new unsigned[columns];
-            std::memcpy(result[i], other.data[i], columns * sizeof(unsigned));
-        }
-    } catch (...) {
-        freeMemory(result, rows, columns);
-        throw;
+// endregion
+
+// region Public Methods
+unsigned Matrix::get(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
     }
+    return rowData(rowIndex)[columnIndex];
+}
 
-    return result;
+void Matrix::set(unsigned rowIndex, unsigned columnIndex, unsigned value) {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    checkData();
+    rowData(rowIndex)[columnIndex] = value % modulo;
+    markDirty({rowIndex, rowIndex + 1, columnIndex, columnIndex + 1});
+}
+
+void Matrix::setRow(unsigned rowIndex, const std::vector<unsigned> &values) {
+    if (rowIndex >= rows) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    if (values.size() != columns) {
+        throw std::invalid_argument("The number of values must be the number of columns of the matrix");
+    }
+    checkData();
+    unsigned *row = rowData(rowIndex);
+    for (unsigned j = 0; j < columns; ++j) {
+        row[j] = values[j] % modulo;
+    }
+    markDirty({rowIndex, rowIndex + 1, 0, columns});
+}
+
+std::vector<Matrix::Region> Matrix::getDirtyRegions(uint64_t since) const {
+    if (since >= generation) {
+        return {};
+    }
+    if (since < truncatedGeneration) {
+        return {{0, rows, 0, columns}};
+    }
+
+    std::vector<Region> regions;
+    for (const Change &change: changes) {
+        if (change.generation > since) {
+            regions.push_back(change.region);
+        }
+    }
+    return regions;
 }
-// endregion
 
-// region Public Methods
 // region Add
 Matrix &Matrix::add(const Matrix &other) {
-    static Add op;
-    applyOperator(other, op);
+    return add(other, Operand::Normal);
+}
+
+Matrix &Matrix::add(const Matrix &other, Operand operand) {
+    const unsigned n = modulo;
+    applyOperator(other, [n](unsigned a, unsigned b) { return Modular::add(a, b, n); }, operand);
     return *this;
 }
 
-Matrix Matrix::addStatic(const Matrix &other) const {
+Matrix Matrix::addStatic(const Matrix &other, Operand operand) const {
     Matrix result(*this);
-    result.add(other);
+    result.add(other, operand);
     return result;
 }
 
@@ -92,14 +156,18 @@ Matrix *Matrix::addDynamic(const Matrix &other) const {
 
 // region Sub
 Matrix &Matrix::sub(const Matrix &other) {
-    static Sub op;
-    applyOperator(other, op);
+    return sub(other, Operand::Normal);
+}
+
+Matrix &Matrix::sub(const Matrix &other, Operand operand) {
+    const unsigned n = modulo;
+    applyOperator(other, [n](unsigned a, unsigned b) { return Modular::sub(a, b, n); }, operand);
     return *this;
 }
 
-Matrix Matrix::subStatic(const Matrix &other) const {
+Matrix Matrix::subStatic(const Matrix &other, Operand operand) const {
     Matrix result(*this);
-    result.sub(other);
+    result.sub(other, operand);
     return result;
 }
 
@@ -112,14 +180,28 @@ Matrix *Matrix::subDynamic(const Matrix &other) const {
 
 // region Multiply
 Matrix &Matrix::multiply(const Matrix &other) {
-    static Multiply op;
-    applyOperator(other, op);
+    return multiply(other, Operand::Normal);
+}
+
+Matrix &Matrix::multiply(const Matrix &other, Operand operand) {
+    const unsigned n = modulo;
+    if (operand == Operand::Transposed) {
+        applyOperator(other, [n](unsigned a, unsigned b) { return Modular::multiply(a, b, n); }, operand);
+        return *this;
+    }
+
+    // The rows are read through direct pointers, with a 64 bits product when it could overflow
+    if (n <= SMALL_MODULO) {
+        applyFused(&other, nullptr, [n](unsigned a, unsigned b, unsigned) { return a * b % n; });
+    } else {
+        applyFused(&other, nullptr, [n](unsigned a, unsigned b, unsigned) { return Modular::multiply(a, b, n); });
+    }
     return *this;
 }
 
-Matrix Matrix::multiplyStatic(const Matrix &other) const {
+Matrix Matrix::multiplyStatic(const Matrix &other, Operand operand) const {
     Matrix result(*this);
-    result.multiply(other);
+    result.multiply(other, operand);
     return result;
 }
 
@@ -129,6 +211,781 @@ Matrix *Matrix::multiplyDynamic(const Matrix &other) const {
     return result;
 }
 // endregion
+
+Matrix Matrix::product(const Matrix &other, Operand operand) const {
+    if (other.modulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+
+    checkData();
+    other.checkData();
+
+    const bool transposed = operand == Operand::Transposed;
+    if (columns != (transposed ? other.columns : other.rows)) {
+        throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+    }
+
+    Matrix result = zeros(rows, transposed ? other.rows : other.columns, modulo, data.resource());
+    productInto(other, transposed, result.data.mutableData());
+    return result;
+}
+
+Vector Matrix::product(const Vector &vector) const {
+    checkData();
+    checkProductVector(vector);
+
+    Vector result = Vector::zeros(rows, modulo);
+    const unsigned *elements = vector.elements.data();
+    unsigned *resultElements = result.elements.data();
+    vectorProductsInto(&elements, &resultElements, 1);
+    return result;
+}
+
+std::vector<Vector> Matrix::product(const std::vector<Vector> &vectors) const {
+    checkData();
+    for (const Vector &vector: vectors) {
+        checkProductVector(vector);
+    }
+
+    std::vector<Vector> results(vectors.size(), Vector::zeros(rows, modulo));
+    std::vector<const unsigned *> elements(vectors.size());
+    std::vector<unsigned *> resultElements(vectors.size());
+    for (std::size_t v = 0; v < vectors.size(); ++v) {
+        elements[v] = vectors[v].elements.data();
+        resultElements[v] = results[v].elements.data();
+    }
+    vectorProductsInto(elements.data(), resultElements.data(), vectors.size());
+    return results;
+}
+
+void Matrix::vectorProductsInto(const unsigned *const *vectors, unsigned *const *results, std::size_t count) const {
+    if (count == 0) {
+        return;
+    }
+
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::productGrain() / (std::size_t(columns) * count));
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        for (std::size_t i = firstRow; i < lastRow; ++i) {
+            const unsigned *row = rowData(unsigned(i));
+            for (std::size_t v = 0; v < count; ++v) {
+                results[v][i] = Modular::dot(row, vectors[v], columns, modulo);
+            }
+        }
+    });
+}
+
+void Matrix::checkProductVector(const Vector &vector) const {
+    if (vector.modulo != modulo) {
+        throw std::invalid_argument("The modulo of the matrix and the vector must be identical");
+    }
+    if (vector.getSize() != columns) {
+        throw std::invalid_argument("The size of the vector must be the number of columns of the matrix");
+    }
+}
+
+void Matrix::productInto(const Matrix &other, bool transposed, unsigned *elements) const {
+    const unsigned resultColumns = transposed ? other.rows : other.columns;
+    const uint64_t interval = Modular::reductionInterval(modulo);
+
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::productGrain() /
+                                                          (std::size_t(columns) * resultColumns));
+    // The columns of the result are accumulated by blocks, so that the accumulators and the block of each row of the
+    // other matrix stay in the cache
+    const unsigned tunedBlock = Tuning::productBlock();
+    const unsigned block = tunedBlock == 0 ? resultColumns : std::min(tunedBlock, resultColumns);
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        std::vector<uint64_t> accumulators(transposed ? 0 : block);
+        for (auto i = unsigned(firstRow); i < lastRow; ++i) {
+            const unsigned *row = rowData(i);
+            unsigned *resultRow = elements + std::size_t(i) * resultColumns;
+
+            if (transposed) {
+                // Dot product of the row i of this matrix and the row j of the other matrix
+                for (unsigned j = 0; j < resultColumns; ++j) {
+                    const unsigned *otherRow = other.rowData(j);
+                    uint64_t sum = 0, pending = 0;
+                    for (unsigned k = 0; k < columns; ++k) {
+                        sum += uint64_t(row[k]) * otherRow[k];
+                        if (++pending == interval) {
+                            sum %= modulo;
+                            pending = 0;
+                        }
+                    }
+                    resultRow[j] = unsigned(sum % modulo);
+                }
+            } else {
+                // Linear combination of the rows of the other matrix, each accumulator receives one product per k
+                for (unsigned firstColumn = 0; firstColumn < resultColumns; firstColumn += block) {
+                    const unsigned width = std::min(block, resultColumns - firstColumn);
+                    std::fill(accumulators.begin(), accumulators.begin() + width, 0);
+                    uint64_t pending = 0;
+                    for (unsigned k = 0; k < columns; ++k) {
+                        const uint64_t value = row[k];
+                        const unsigned *otherRow = other.rowData(k) + firstColumn;
+                        for (unsigned j = 0; j < width; ++j) {
+                            accumulators[j] += value * otherRow[j];
+                        }
+                        if (++pending == interval) {
+                            for (unsigned j = 0; j < width; ++j) {
+                                accumulators[j] %= modulo;
+                            }
+                            pending = 0;
+                        }
+                    }
+                    for (unsigned j = 0; j < width; ++j) {
+                        resultRow[firstColumn + j] = unsigned(accumulators[j] % modulo);
+                    }
+                }
+            }
+        }
+    });
+}
+
+template<unsigned N>
+void Matrix::powFixed(uint64_t exponent, unsigned *elements) const {
+    using Block = std::array<unsigned, N * N>;
+    const unsigned n = modulo;
+
+    // N products can be summed before the reduction unless the modulo is close to 2^32
+    const bool delayed = Modular::reductionInterval(n) >= N;
+    auto multiply = [n, delayed](const Block &a, const Block &b) {
+        Block c{};
+        for (unsigned i = 0; i < N; ++i) {
+            for (unsigned j = 0; j < N; ++j) {
+                uint64_t sum = 0;
+                for (unsigned k = 0; k < N; ++k) {
+                    sum = delayed ? sum + uint64_t(a[i * N + k]) * b[k * N + j]
+                                  : Modular::add(unsigned(sum), Modular::multiply(a[i * N + k], b[k * N + j], n), n);
+                }
+                c[i * N + j] = unsigned(sum % n);
+            }
+        }
+        return c;
+    };
+
+    Block base, result{};
+    std::copy(data.data(), data.data() + N * N, base.begin());
+    for (unsigned i = 0; i < N; ++i) {
+        result[i * N + i] = 1 % n;
+    }
+    for (; exponent != 0; exponent >>= 1) {
+        if (exponent & 1u) {
+            result = multiply(result, base);
+        }
+        if (exponent > 1) {
+            base = multiply(base, base);
+        }
+    }
+    std::copy(result.begin(), result.end(), elements);
+}
+
+Matrix Matrix::pow(uint64_t exponent) const {
+    checkData();
+
+    if (rows != columns) {
+        throw std::invalid_argument("The matrix must be square to be raised to a power");
+    }
+
+    Matrix result = zeros(rows, columns, modulo, data.resource());
+    unsigned *elements = result.data.mutableData();
+    switch (rows) {
+        case 1:
+            elements[0] = Modular::pow(data.data()[0], exponent, modulo);
+            return result;
+        case 2:
+            powFixed<2>(exponent, elements);
+            return result;
+        case 3:
+            powFixed<3>(exponent, elements);
+            return result;
+        case 4:
+            powFixed<4>(exponent, elements);
+            return result;
+        default:
+            break;
+    }
+
+    // Each product is written to the scratch matrix which is then swapped with its left operand, so no matrix is
+    // allocated within the loop. The result is only a copy of the base until its first product.
+    Matrix base = zeros(rows, columns, modulo, data.resource());
+    Matrix scratch = zeros(rows, columns, modulo, data.resource());
+    std::copy(data.data(), data.data() + data.size(), base.data.mutableData());
+    bool identity = true;
+    for (; exponent != 0; exponent >>= 1) {
+        if (exponent & 1u) {
+            if (identity) {
+                std::copy(base.data.data(), base.data.data() + base.data.size(), result.data.mutableData());
+                identity = false;
+            } else {
+                result.productInto(base, false, scratch.data.mutableData());
+                std::swap(result, scratch);
+            }
+        }
+        if (exponent > 1) {
+            base.productInto(base, false, scratch.data.mutableData());
+            std::swap(base, scratch);
+        }
+    }
+
+    if (identity) {
+        for (unsigned i = 0; i < rows; ++i) {
+            result.data.mutableData()[std::size_t(i) * columns + i] = 1 % modulo;
+        }
+    }
+    return result;
+}
+
+Matrix Matrix::transpose() const {
+    checkData();
+
+    Matrix result(columns, rows, modulo, Fill::Zero, data.resource());
+    Transpose::copy(data.data(), columns, result.data.mutableData(), rows, rows, columns);
+    return result;
+}
+
+Matrix &Matrix::transposeInPlace() {
+    if (rows != columns) {
+        throw std::invalid_argument("The matrix must be square to be transposed in-place");
+    }
+
+    checkData();
+
+    Transpose::square(data.mutableData(), columns, rows);
+    markAllDirty();
+    return *this;
+}
+
+// region Chain product
+
+double Matrix::productCost(unsigned rows, unsigned inner, unsigned columns, unsigned modulo) {
+    const double elements = double(rows) * columns;
+    const double reductions = std::ceil(double(inner) / double(Modular::reductionInterval(modulo))) + 1;
+    return elements * inner + elements * reductions * REDUCTION_COST;
+}
+
+double Matrix::chainOrder(const std::vector<unsigned> &dimensions, unsigned modulo, std::vector<std::size_t> &splits) {
+    const std::size_t count = dimensions.size() - 1;
+    std::vector<double> costs(count * count, 0);
+    splits.assign(count * count, 0);
+
+    // The cheapest order of each sub-chain, by increasing length
+    for (std::size_t length = 2; length <= count; ++length) {
+        for (std::size_t i = 0; i + length <= count; ++i) {
+            const std::size_t j = i + length - 1;
+            costs[i * count + j] = std::numeric_limits<double>::infinity();
+            for (std::size_t split = i; split < j; ++split) {
+                const double cost = costs[i * count + split] + costs[(split + 1) * count + j] +
+                                    productCost(dimensions[i], dimensions[split + 1], dimensions[j + 1], modulo);
+                if (cost < costs[i * count + j]) {
+                    costs[i * count + j] = cost;
+                    splits[i * count + j] = split;
+                }
+            }
+        }
+    }
+    return costs[count - 1];
+}
+
+std::vector<unsigned> Matrix::chainDimensions(const std::vector<std::reference_wrapper<const Matrix>> &operands) {
+    if (operands.empty()) {
+        throw std::invalid_argument("The chain must contain at least one matrix");
+    }
+
+    std::vector<unsigned> dimensions{operands.front().get().rows};
+    for (const Matrix &operand: operands) {
+        if (operand.modulo != operands.front().get().modulo) {
+            throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+        }
+        if (dimensions.back() != operand.rows) {
+            throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+        }
+        dimensions.push_back(operand.columns);
+    }
+    return dimensions;
+}
+
+double Matrix::chainCost(const std::vector<std::reference_wrapper<const Matrix>> &operands) {
+    std::vector<std::size_t> splits;
+    return chainOrder(chainDimensions(operands), operands.front().get().modulo, splits);
+}
+
+Matrix Matrix::chainProduct(const std::vector<std::reference_wrapper<const Matrix>> &operands) {
+    const std::vector<unsigned> dimensions = chainDimensions(operands);
+    for (const Matrix &operand: operands) {
+        operand.checkData();
+    }
+
+    const Matrix &first = operands.front();
+    if (operands.size() == 1) {
+        return first;
+    }
+
+    const std::size_t count = operands.size();
+    std::vector<std::size_t> splits;
+    chainOrder(dimensions, first.modulo, splits);
+
+    // Consumed intermediate results, whose buffers are reused by the next ones. The elements of a row start at
+    // row * columns whatever the size of the buffer, so a larger buffer is as good as an exact one.
+    std::vector<Matrix> spares;
+    auto acquire = [&](unsigned rows, unsigned columns) {
+        const std::size_t size = std::size_t(rows) * columns;
+        auto best = spares.end();
+        for (auto spare = spares.begin(); spare != spares.end(); ++spare) {
+            if (spare->data.size() >= size && (best == spares.end() || spare->data.size() < best->data.size())) {
+                best = spare;
+            }
+        }
+        if (best == spares.end()) {
+            return Matrix(rows, columns, first.modulo, Fill::None, first.data.resource());
+        }
+        Matrix result = std::move(*best);
+        spares.erase(best);
+        result.rows = rows;
+        result.columns = columns;
+        result.modulo = first.modulo;
+        return result;
+    };
+
+    // Computes the chain [i, j] in an intermediate matrix, or in a matrix of the exact size for the whole chain
+    std::function<Matrix(std::size_t, std::size_t)> evaluate = [&](std::size_t i, std::size_t j) {
+        const std::size_t split = splits[i * count + j];
+        std::optional<Matrix> left, right;
+        if (split != i) {
+            left = evaluate(i, split);
+        }
+        if (split + 1 != j) {
+            right = evaluate(split + 1, j);
+        }
+
+        const bool whole = i == 0 && j == count - 1;
+        Matrix result = whole ? Matrix(dimensions[i], dimensions[j + 1], first.modulo, Fill::None, first.data.resource())
+                              : acquire(dimensions[i], dimensions[j + 1]);
+        const Matrix &leftOperand = left ? *left : operands[i].get();
+        leftOperand.productInto(right ? *right : operands[j].get(), false, result.data.mutableData());
+        for (std::optional<Matrix> *consumed: {&left, &right}) {
+            if (*consumed) {
+                spares.push_back(std::move(**consumed));
+            }
+        }
+        return result;
+    };
+    return evaluate(0, count - 1);
+}
+// endregion
+
+// region Linear algebra
+
+unsigned Matrix::rank() const {
+    return LUDecomposition(*this).getRank();
+}
+
+unsigned Matrix::determinant() const {
+    if (rows != columns) {
+        throw std::invalid_argument("The matrix must be square");
+    }
+    return LUDecomposition(*this).determinant();
+}
+
+Matrix Matrix::inverse() const {
+    if (rows != columns) {
+        throw std::invalid_argument("The matrix must be square");
+    }
+    return LUDecomposition(*this).inverse();
+}
+
+Matrix Matrix::solve(const Matrix &rhs) const {
+    if (rows != columns) {
+        throw std::invalid_argument("The matrix must be square");
+    }
+    return LUDecomposition(*this).solve(rhs);
+}
+// endregion
+
+// region Fused operations
+
+template<typename ElementFunction>
+void Matrix::applyFused(const Matrix *first, const Matrix *second, ElementFunction op) {
+    checkData();
+
+    unsigned maxRows = rows, maxColumns = columns;
+    for (const Matrix *other: {first, second}) {
+        if (other) {
+            if (other->modulo != modulo) {
+                throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+            }
+            other->checkData();
+            maxRows = std::max(maxRows, other->rows);
+            maxColumns = std::max(maxColumns, other->columns);
+        }
+    }
+
+    // Same rule as applyOperator, each element is read before being written at the same position
+    const bool inPlace = maxRows == rows && maxColumns == columns && !data.isShared();
+    SharedBuffer result = inPlace ? SharedBuffer() : SharedBuffer(std::size_t(maxRows) * maxColumns, data.resource());
+    unsigned *elements = inPlace ? data.mutableData() : result.mutableData();
+
+    // A row can be processed with direct pointers when it is complete in all the matrices
+    auto isFullRow = [maxColumns](const Matrix *m, unsigned i) {
+        return !m || (i < m->rows && m->columns == maxColumns);
+    };
+
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / maxColumns);
+    Parallel::forRange(0, maxRows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        for (auto i = unsigned(firstRow); i < lastRow; ++i) {
+            unsigned *resultRow = elements + std::size_t(i) * maxColumns;
+            if (isFullRow(this, i) && isFullRow(first, i) && isFullRow(second, i)) {
+                const unsigned *row = std::as_const(*this).rowData(i);
+                const unsigned *firstRow = first ? first->rowData(i) : nullptr;
+                const unsigned *secondRow = second ? second->rowData(i) : nullptr;
+                for (unsigned j = 0; j < maxColumns; ++j) {
+                    resultRow[j] = op(row[j], firstRow ? firstRow[j] : 0, secondRow ? secondRow[j] : 0);
+                }
+            } else {
+                for (unsigned j = 0; j < maxColumns; ++j) {
+                    resultRow[j] = op(checkBounds(i, j), first ? first->checkBounds(i, j) : 0,
+                                      second ? second->checkBounds(i, j) : 0);
+                }
+            }
+        }
+    });
+
+    if (!inPlace) {
+        data = std::move(result);
+        rows = maxRows;
+        columns = maxColumns;
+    }
+    markAllDirty();
+}
+
+Matrix &Matrix::multiplyAdd(const Matrix &factor, const Matrix &addend) {
+    const unsigned n = modulo;
+    if (n <= SMALL_MODULO) {
+        applyFused(&factor, &addend, [n](unsigned a, unsigned b, unsigned c) { return (a * b + c) % n; });
+    } else {
+        applyFused(&factor, &addend, [n](unsigned a, unsigned b, unsigned c) {
+            return unsigned((uint64_t(a) * b + c) % n);
+        });
+    }
+    return *this;
+}
+
+Matrix Matrix::multiplyAddStatic(const Matrix &factor, const Matrix &addend) const {
+    Matrix result(*this);
+    result.multiplyAdd(factor, addend);
+    return result;
+}
+
+Matrix &Matrix::addScalar(unsigned scalar) {
+    checkData();
+    const unsigned n = modulo, k = scalar % modulo;
+    applyFused(nullptr, nullptr, [n, k](unsigned a, unsigned, unsigned) { return Modular::add(a, k, n); });
+    return *this;
+}
+
+Matrix Matrix::addScalarStatic(unsigned scalar) const {
+    Matrix result(*this);
+    result.addScalar(scalar);
+    return result;
+}
+
+Matrix &Matrix::multiplyScalar(unsigned scalar) {
+    checkData();
+    const unsigned n = modulo, k = scalar % modulo;
+    if (n <= SMALL_MODULO) {
+        applyFused(nullptr, nullptr, [n, k](unsigned a, unsigned, unsigned) { return a * k % n; });
+    } else {
+        applyFused(nullptr, nullptr, [n, k](unsigned a, unsigned, unsigned) { return Modular::multiply(a, k, n); });
+    }
+    return *this;
+}
+
+Matrix Matrix::multiplyScalarStatic(unsigned scalar) const {
+    Matrix result(*this);
+    result.multiplyScalar(scalar);
+    return result;
+}
+
+Matrix &Matrix::axpy(unsigned alpha, const Matrix &x) {
+    checkData();
+    const unsigned n = modulo, k = alpha % modulo;
+    if (n <= SMALL_MODULO) {
+        applyFused(&x, nullptr, [n, k](unsigned y, unsigned value, unsigned) { return (k * value + y) % n; });
+    } else {
+        applyFused(&x, nullptr, [n, k](unsigned y, unsigned value, unsigned) {
+            return unsigned((uint64_t(k) * value + y) % n);
+        });
+    }
+    return *this;
+}
+
+Matrix Matrix::axpyStatic(unsigned alpha, const Matrix &x) const {
+    Matrix result(*this);
+    result.axpy(alpha, x);
+    return result;
+}
+
+template<typename ElementFunction>
+void Matrix::applyBroadcast(const Vector &vector, Axis axis, ElementFunction op) {
+    checkData();
+    if (vector.modulo != modulo) {
+        throw std::invalid_argument("The modulo of the matrix and the vector must be identical");
+    }
+    if (axis == Axis::Row && vector.getSize() != columns) {
+        throw std::invalid_argument("The size of the row vector must be the number of columns of the matrix");
+    }
+    if (axis == Axis::Column && vector.getSize() != rows) {
+        throw std::invalid_argument("The size of the column vector must be the number of rows of the matrix");
+    }
+
+    // A shared buffer is not copied first, the results are written directly to a new buffer
+    const bool inPlace = !data.isShared();
+    SharedBuffer result = inPlace ? SharedBuffer() : SharedBuffer(data.size(), data.resource());
+    const unsigned *source = data.data();
+    unsigned *destination = inPlace ? data.mutableData() : result.mutableData();
+    const unsigned *values = vector.elements.data();
+
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / columns);
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        for (std::size_t i = firstRow; i < lastRow; ++i) {
+            const unsigned *row = source + i * columns;
+            unsigned *resultRow = destination + i * columns;
+            if (axis == Axis::Row) {
+                for (unsigned j = 0; j < columns; ++j) {
+                    resultRow[j] = op(row[j], values[j]);
+                }
+            } else {
+                const unsigned value = values[i];
+                for (unsigned j = 0; j < columns; ++j) {
+                    resultRow[j] = op(row[j], value);
+                }
+            }
+        }
+    });
+
+    if (!inPlace) {
+        data = std::move(result);
+    }
+    markAllDirty();
+}
+
+Matrix &Matrix::addBroadcast(const Vector &vector, Axis axis) {
+    const unsigned n = modulo;
+    applyBroadcast(vector, axis, [n](unsigned a, unsigned b) { return Modular::add(a, b, n); });
+    return *this;
+}
+
+Matrix Matrix::addBroadcastStatic(const Vector &vector, Axis axis) const {
+    Matrix result(*this);
+    result.addBroadcast(vector, axis);
+    return result;
+}
+
+Matrix &Matrix::subBroadcast(const Vector &vector, Axis axis) {
+    const unsigned n = modulo;
+    applyBroadcast(vector, axis, [n](unsigned a, unsigned b) { return Modular::sub(a, b, n); });
+    return *this;
+}
+
+Matrix Matrix::subBroadcastStatic(const Vector &vector, Axis axis) const {
+    Matrix result(*this);
+    result.subBroadcast(vector, axis);
+    return result;
+}
+
+Matrix &Matrix::multiplyBroadcast(const Vector &vector, Axis axis) {
+    const unsigned n = modulo;
+    if (n <= SMALL_MODULO) {
+        applyBroadcast(vector, axis, [n](unsigned a, unsigned b) { return a * b % n; });
+    } else {
+        applyBroadcast(vector, axis, [n](unsigned a, unsigned b) { return Modular::multiply(a, b, n); });
+    }
+    return *this;
+}
+
+Matrix Matrix::multiplyBroadcastStatic(const Vector &vector, Axis axis) const {
+    Matrix result(*this);
+    result.multiplyBroadcast(vector, axis);
+    return result;
+}
+
+Matrix &Matrix::powElements(uint64_t exponent) {
+    checkData();
+
+    // A shared buffer is not copied first, the powers are written directly to a new buffer
+    const bool inPlace = !data.isShared();
+    SharedBuffer result = inPlace ? SharedBuffer() : SharedBuffer(data.size(), data.resource());
+    const unsigned *source = data.data();
+    unsigned *destination = inPlace ? data.mutableData() : result.mutableData();
+
+    // Each element costs one product per bit of the exponent, so the rows are split in smaller ranges
+    std::size_t bits = 1;
+    for (uint64_t e = exponent; e > 1; e >>= 1) {
+        ++bits;
+    }
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / (std::size_t(columns) * bits));
+
+    const unsigned n = modulo;
+    const bool montgomery = n % 2 == 1 && n > 1;
+    const Montgomery arithmetic(montgomery ? n : 1);
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        const std::size_t first = firstRow * columns, count = (lastRow - firstRow) * columns;
+        if (montgomery) {
+            arithmetic.pow(source + first, destination + first, count, exponent);
+        } else {
+            for (std::size_t i = first; i < first + count; ++i) {
+                destination[i] = Modular::pow(source[i], exponent, n);
+            }
+        }
+    });
+
+    if (!inPlace) {
+        data = std::move(result);
+    }
+    markAllDirty();
+    return *this;
+}
+
+Matrix Matrix::powElementsStatic(uint64_t exponent) const {
+    Matrix result(*this);
+    result.powElements(exponent);
+    return result;
+}
+// endregion
+
+// region Reductions
+
+template<typename T, typename RangeReduction, typename Combination>
+T Matrix::reduceElements(T identity, RangeReduction reduceRange, Combination combine) const {
+    checkData();
+
+    // Each thread reduces its range on its own, the partial values are only combined at the end
+    T result = identity;
+    std::mutex mutex;
+    Parallel::forRange(0, data.size(), Tuning::elementGrain(), [&](std::size_t first, std::size_t last) {
+        T partial = reduceRange(first, last);
+        std::lock_guard<std::mutex> lock(mutex);
+        result = combine(result, partial);
+    });
+    return result;
+}
+
+unsigned Matrix::sum() const {
+    const unsigned n = modulo;
+    const uint64_t interval = Modular::additionInterval(n);
+    const unsigned *elements = data.data();
+    return reduceElements(0u, [elements, n, interval](std::size_t first, std::size_t last) {
+        uint64_t total = 0;
+        while (first < last) {
+            // Plain additions that the compiler vectorizes, reduced once per interval
+            const std::size_t end = first + std::size_t(std::min<uint64_t>(interval, last - first));
+            uint64_t partial = 0;
+            for (std::size_t e = first; e < end; ++e) {
+                partial += elements[e];
+            }
+            total = (total + partial % n) % n;
+            first = end;
+        }
+        return unsigned(total);
+    }, [n](unsigned lhs, unsigned rhs) { return Modular::add(lhs, rhs, n); });
+}
+
+unsigned Matrix::trace() const {
+    checkData();
+
+    // Less than 2^32 values lower than 2^32, the accumulator cannot overflow
+    uint64_t total = 0;
+    for (unsigned i = 0; i < std::min(rows, columns); ++i) {
+        total += rowData(i)[i];
+    }
+    return unsigned(total % modulo);
+}
+
+std::vector<unsigned> Matrix::rowSums() const {
+    checkData();
+
+    std::vector<unsigned> sums(rows);
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / columns);
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        for (auto i = unsigned(firstRow); i < lastRow; ++i) {
+            const unsigned *row = rowData(i);
+            uint64_t total = 0;
+            for (unsigned j = 0; j < columns; ++j) {
+                total += row[j];
+            }
+            sums[i] = unsigned(total % modulo);
+        }
+    });
+    return sums;
+}
+
+std::vector<unsigned> Matrix::columnSums() const {
+    checkData();
+
+    std::vector<unsigned> sums(columns, 0);
+    std::mutex mutex;
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / columns);
+    Parallel::forRange(0, rows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        // Each accumulator receives less than 2^32 values, it is reduced once when merged
+        std::vector<uint64_t> partial(columns, 0);
+        for (auto i = unsigned(firstRow); i < lastRow; ++i) {
+            const unsigned *row = rowData(i);
+            for (unsigned j = 0; j < columns; ++j) {
+                partial[j] += row[j];
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (unsigned j = 0; j < columns; ++j) {
+            sums[j] = Modular::add(sums[j], unsigned(partial[j] % modulo), modulo);
+        }
+    });
+    return sums;
+}
+
+unsigned Matrix::min() const {
+    const unsigned *elements = data.data();
+    return reduceElements(std::numeric_limits<unsigned>::max(), [elements](std::size_t first, std::size_t last) {
+        unsigned value = std::numeric_limits<unsigned>::max();
+        for (std::size_t e = first; e < last; ++e) {
+            value = std::min(value, elements[e]);
+        }
+        return value;
+    }, [](unsigned lhs, unsigned rhs) { return std::min(lhs, rhs); });
+}
+
+unsigned Matrix::max() const {
+    const unsigned *elements = data.data();
+    return reduceElements(0u, [elements](std::size_t first, std::size_t last) {
+        unsigned value = 0;
+        for (std::size_t e = first; e < last; ++e) {
+            value = std::max(value, elements[e]);
+        }
+        return value;
+    }, [](unsigned lhs, unsigned rhs) { return std::max(lhs, rhs); });
+}
+
+std::size_t Matrix::count(unsigned value) const {
+    const unsigned *elements = data.data();
+    return reduceElements(std::size_t(0), [elements, value](std::size_t first, std::size_t last) {
+        std::size_t found = 0;
+        for (std::size_t e = first; e < last; ++e) {
+            found += elements[e] == value;
+        }
+        return found;
+    }, [](std::size_t lhs, std::size_t rhs) { return lhs + rhs; });
+}
+
+uint64_t Matrix::hash() const {
+    checkData();
+
+    uint64_t elementsHash = data.rememberedHash();
+    if (elementsHash == 0) {
+        elementsHash = hashElements(data.data(), data.size());
+        data.rememberHash(elementsHash);
+    }
+    return elementsHash ^ ((uint64_t(rows) << 32 | columns) * 0x9E3779B97F4A7C15ull) ^ (uint64_t(modulo) << 17);
+}
+// endregion
 // endregion
 
 // region Operators
@@ -136,17 +993,15 @@ Matrix *Matrix::multiplyDynamic(const Matrix &other) const {
 Matrix &Matrix::operator=(const Matrix &other) {
     // Check auto-affectation
     if (this != &other) {
-        freeMemory(data, rows, columns);
+        // Share or duplicate the elements first, nothing is modified if it throws
+        data = other.copyOnWrite ? other.data : other.data.clone();
 
         // Get the resources from the other object
         rows = other.rows;
         columns = other.columns;
         modulo = other.modulo;
-
-        // Allocate new resources and copy the data if not null
-        if (other.data != nullptr) {
-            data = copyData(other);
-        }
+        copyOnWrite = other.copyOnWrite;
+        markAllDirty();
     }
     return *this;
 }
@@ -154,13 +1009,13 @@ Matrix &Matrix::operator=(const Matrix &other) {
 Matrix &Matrix::operator=(Matrix &&other) noexcept {
     // Check auto-affectation
     if (this != &other) {
-        freeMemory(data, rows, columns);
-
         // Get the resources from the other object
-        data = std::exchange(other.data, nullptr);
+        data = std::move(other.data);
+        copyOnWrite = other.copyOnWrite;
         rows = std::exchange(other.rows, 0);
         columns = std::exchange(other.columns, 0);
         modulo = std::exchange(other.modulo, 0);
+        markAllDirty();
     }
     return *this;
 }
@@ -168,81 +1023,202 @@ Matrix &Matrix::operator=(Matrix &&other) noexcept {
 std::ostream &operator<<(std::ostream &os, const Matrix &matrix) {
     for (unsigned i = 0; i < matrix.rows; ++i) {
         for (unsigned j = 0; j < matrix.columns; ++j) {
-            os << matrix.data[i][j] << " ";
+            os << matrix.rowData(i)[j] << " ";
         }
         os << std::endl;
     }
     return os;
 }
-// endregion
 
-// region Private Methods
+bool operator==(const Matrix &lhs, const Matrix &rhs) {
+    if (lhs.rows != rhs.rows || lhs.columns != rhs.columns || lhs.modulo != rhs.modulo) {
+        return false;
+    }
 
-void Matrix::freeMemory(unsigned** &dataToFree, unsigned& dataRows, unsigned& dataCols) {
-    for (unsigned i = 0; i < dataRows; ++i) {
-        delete[] dataToFree[i];
+    // Copies sharing the buffer are equal, as are two moved matrices
+    const unsigned *left = lhs.data.data(), *right = rhs.data.data();
+    if (left == right) {
+        return true;
+    }
+    if (!left || !right) {
+        return false;
     }
-    delete[] dataToFree;
-    dataToFree = nullptr;
-    dataRows = 0;
-    dataCols = 0;
+
+    const uint64_t leftHash = lhs.data.rememberedHash(), rightHash = rhs.data.rememberedHash();
+    if (leftHash != 0 && rightHash != 0 && leftHash != rightHash) {
+        return false;
+    }
+    return Matrix::elementsEqual(left, right, lhs.data.size());
 }
 
-void Matrix::applyOperator(const Matrix &other, const Operator &op) {
+bool operator!=(const Matrix &lhs, const Matrix &rhs) {
+    return !(lhs == rhs);
+}
+// endregion
+
+// region Private Methods
+
+template<typename ElementFunction>
+void Matrix::applyOperator(const Matrix &other, ElementFunction op, Operand operand) {
     if (other.modulo != modulo) {
         throw std::invalid_argument(
                 "The modulo of the 2 matrices must be identical");
     }
 
-    if (other.data == nullptr) {
+    if (other.data.data() == nullptr) {
         throw std::runtime_error("Inner data of the matrix is null!");
     }
 
-    if(data == nullptr){
+    if(data.data() == nullptr){
         throw std::runtime_error("Inner data of the matrix is null!");
     }
 
-    unsigned maxRows = std::max(rows, other.rows);
-    unsigned maxColumns = std::max(columns, other.columns);
-    unsigned **result;
+    const bool transposed = operand == Operand::Transposed;
+    unsigned maxRows = std::max(rows, transposed ? other.columns : other.rows);
+    unsigned maxColumns = std::max(columns, transposed ? other.rows : other.columns);
 
-    try {
-        result = new unsigned *[maxRows];
-        for (unsigned i = 0; i < maxRows; ++i) {
-            result[i] = new unsigned[maxColumns];
-            for (unsigned j = 0; j < maxColumns; ++j) {
-                unsigned valM1 = checkBounds(i, j);
-                unsigned valM2 = other.checkBounds(i, j);
+    // The result is written over the elements when the size does not change and no copy shares them. Otherwise the
+    // old elements (possibly shared) are only read and a new buffer receives the result. The transpose of this
+    // matrix would be read after being overwritten, so it also needs a new buffer.
+    const bool inPlace = maxRows == rows && maxColumns == columns && !data.isShared() &&
+                         !(transposed && other.data.data() == data.data());
+    SharedBuffer result = inPlace ? SharedBuffer() : SharedBuffer(std::size_t(maxRows) * maxColumns, data.resource());
+    unsigned *elements = inPlace ? data.mutableData() : result.mutableData();
 
-                // Adjust valM1 to prevent underflow for sub.
-                // This has no effect on addition/multiplication
-                valM1 += modulo;
-                result[i][j] = op.apply(valM1 + modulo, valM2) % modulo;
+    // The rows are processed by contiguous chunks, the same partition as the first touch of the Matrix fill: with
+    // Parallel::setPinning, a thread finds its rows on its own node (see PageResource)
+    const std::size_t rowGrain = std::max<std::size_t>(1, Tuning::elementGrain() / maxColumns);
+    Parallel::forRange(0, maxRows, rowGrain, [&](std::size_t firstRow, std::size_t lastRow) {
+        // Square blocks, a transposed operand is read column by column within a block of its rows
+        for (auto blockRow = unsigned(firstRow); blockRow < lastRow; blockRow += BLOCK) {
+            const auto blockRowEnd = unsigned(std::min<std::size_t>(lastRow, std::size_t(blockRow) + BLOCK));
+            for (unsigned blockColumn = 0; blockColumn < maxColumns; blockColumn += BLOCK) {
+                const unsigned blockColumnEnd = std::min(maxColumns, blockColumn + BLOCK);
+                for (unsigned i = blockRow; i < blockRowEnd; ++i) {
+                    for (unsigned j = blockColumn; j < blockColumnEnd; ++j) {
+                        unsigned valM1 = checkBounds(i, j);
+                        unsigned valM2 = transposed ? other.checkBounds(j, i) : other.checkBounds(i, j);
+                        elements[std::size_t(i) * maxColumns + j] = op(valM1, valM2);
+                    }
+                }
             }
-            if (i < rows) {
-                // Delete the old row after its contents have been used
-                delete[] data[i];
+        }
+    });
+
+    // Update the matrix to use the new data
+    if (!inPlace) {
+        data = std::move(result);
+        rows = maxRows;
+        columns = maxColumns;
+    }
+    markAllDirty();
+}
+
+uint64_t Matrix::hashElements(const unsigned *elements, std::size_t count) {
+    constexpr std::size_t LANES = 16;
+    constexpr uint32_t MULTIPLIER = 0x9E3779B1u;
+
+    // Each lane mixes every 16th element, the lanes start from different values so that they are not symmetric
+    uint32_t lanes[LANES];
+    for (std::size_t l = 0; l < LANES; ++l) {
+        lanes[l] = uint32_t(l * 0x85EBCA77u + 1);
+    }
+    std::size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (std::size_t l = 0; l < LANES; ++l) {
+            lanes[l] = (lanes[l] ^ elements[i + l]) * MULTIPLIER;
+        }
+    }
+    for (std::size_t l = 0; i < count; ++i, ++l) {
+        lanes[l] = (lanes[l] ^ elements[i]) * MULTIPLIER;
+    }
+
+    // The lanes and the count are combined with the finalizer of SplitMix64
+    auto mix = [](uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    };
+    uint64_t hash = mix(count);
+    for (uint32_t lane: lanes) {
+        hash = mix(hash ^ lane);
+    }
+    return hash != 0 ? hash : 1;
+}
+
+bool Matrix::elementsEqual(const unsigned *lhs, const unsigned *rhs, std::size_t count) {
+    constexpr std::size_t LANES = 16, BLOCK = 1024;
+
+    // The differences of a block are accumulated without branch, the comparison stops at the first different block
+    for (std::size_t first = 0; first < count; first += BLOCK) {
+        const std::size_t last = std::min(count, first + BLOCK);
+        unsigned differences[LANES] = {};
+        std::size_t i = first;
+        for (; i + LANES <= last; i += LANES) {
+            for (std::size_t l = 0; l < LANES; ++l) {
+                differences[l] |= lhs[i + l] ^ rhs[i + l];
             }
         }
+        for (; i < last; ++i) {
+            differences[0] |= lhs[i] ^ rhs[i];
+        }
 
-        // Delete the top-level array of the old data
-        delete[] data;
+        unsigned difference = 0;
+        for (unsigned lane: differences) {
+            difference |= lane;
+        }
+        if (difference != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Matrix::markDirty(const Region &region) {
+    ++generation;
 
-    } catch (...) {
-        freeMemory(result, maxRows, maxColumns);
-        throw;
+    // Consecutive writes usually extend the last region, by a row or by a column. The merged region takes the new
+    // generation, a reader that saw the old one reads it again
+    if (!changes.empty()) {
+        Change &last = changes.back();
+        Region &merged = last.region;
+        const bool sameColumns = region.firstColumn == merged.firstColumn && region.lastColumn == merged.lastColumn;
+        const bool sameRows = region.firstRow == merged.firstRow && region.lastRow == merged.lastRow;
+        if (sameColumns && region.firstRow <= merged.lastRow && region.lastRow >= merged.firstRow) {
+            merged.firstRow = std::min(merged.firstRow, region.firstRow);
+            merged.lastRow = std::max(merged.lastRow, region.lastRow);
+            last.generation = generation;
+            return;
+        }
+        if (sameRows && region.firstColumn <= merged.lastColumn && region.lastColumn >= merged.firstColumn) {
+            merged.firstColumn = std::min(merged.firstColumn, region.firstColumn);
+            merged.lastColumn = std::max(merged.lastColumn, region.lastColumn);
+            last.generation = generation;
+            return;
+        }
     }
+    changes.push_back({generation, region});
 
-    // Update the matrix to use the new data
-    data = result;
-    rows = maxRows;
-    columns = maxColumns;
+    // The two oldest changes become their bounding box, with the generation of the newer one
+    if (changes.size() > MAX_DIRTY_REGIONS) {
+        const Region &oldest = changes[0].region;
+        Region &next = changes[1].region;
+        next = {std::min(oldest.firstRow, next.firstRow), std::max(oldest.lastRow, next.lastRow),
+                std::min(oldest.firstColumn, next.firstColumn), std::max(oldest.lastColumn, next.lastColumn)};
+        changes.erase(changes.begin());
+    }
+}
+
+void Matrix::checkData() const {
+    if (data.data() == nullptr) {
+        throw std::runtime_error("Inner data of the matrix is null!");
+    }
 }
 
 unsigned Matrix::checkBounds(unsigned rowIndex, unsigned columnIndex) const {
     // Check if the given indices are within the bounds of the matrix
     if (rowIndex < rows && columnIndex < columns) {
-        return data[rowIndex][columnIndex];
+        return rowData(rowIndex)[columnIndex];
     }
     // Return predefined value if the indices are out of bounds
     return EMPTY_CASE;
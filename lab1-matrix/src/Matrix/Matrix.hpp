@@ -1,7 +1,19 @@
 #pragma once
 
 #include "ostream"
-#include "../Operators/Operator.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "SharedBuffer.hpp"
+
+class SparseMatrix;
+class BitMatrix;
+class MatrixBatch;
+class TiledMatrix;
+class Vector;
+
+template<unsigned R, unsigned C, unsigned Modulo>
+class FixedMatrix;
 
 /**
  * @class Matrix
@@ -10,11 +22,70 @@
  * The Matrix class supports addition, subtraction, and multiplication operations performed modulo n.
  */
 class Matrix {
+    friend class SparseMatrix;
+    friend class BitMatrix;
+    friend class MatrixBatch;
+    friend class TiledMatrix;
+    friend class LUDecomposition;
+    friend class RnsMatrix;
+    friend class BandMatrix;
+    friend class MaintainedResult;
+
+    template<unsigned R, unsigned C, unsigned Modulo>
+    friend class FixedMatrix;
+
+public:
+    /** @brief Defines how the other matrix of an operation is read. */
+    enum class Operand {
+        Normal,    // The matrix as is
+        Transposed // The transpose of the matrix, read in place without being built
+    };
+
+    /** @brief Defines how a vector is repeated by the broadcast operations. */
+    enum class Axis {
+        Row,   // The vector is a row combined with each row of the matrix, its size is the number of columns
+        Column // The vector is a column combined with each column of the matrix, its size is the number of rows
+    };
+
+    /** @brief A rectangle of elements: the rows [firstRow, lastRow) and the columns [firstColumn, lastColumn). */
+    struct Region {
+        unsigned firstRow, lastRow, firstColumn, lastColumn;
+    };
+
 private:
+    /** @brief Defines how the elements of a newly allocated matrix are initialized, None when they are all written. */
+    enum class Fill { Random, Zero, None };
+
     // region Fields
-    unsigned **data;
+
+    // Elements stored row after row, shared with the copies of the matrix until one of them is modified
+    SharedBuffer data;
     unsigned rows, columns, modulo;
+    bool copyOnWrite = true;
     const unsigned EMPTY_CASE = 0;
+
+    /** @brief A region written by set() or setRow(), with the generation of its last write. */
+    struct Change {
+        uint64_t generation;
+        Region region;
+    };
+
+    // Incremented by each modification of the matrix. The log keeps the regions written by set() and setRow(), the
+    // modifications up to truncatedGeneration are not in it: the whole matrix may have changed then
+    uint64_t generation = 0, truncatedGeneration = 0;
+    std::vector<Change> changes;
+
+    // Number of changes kept apart, beyond it the two oldest are replaced by their bounding box
+    static constexpr std::size_t MAX_DIRTY_REGIONS = 64;
+
+    // Largest modulo for which n * (n - 1), the bound of a * b + c, fits in 32 bits
+    static constexpr unsigned SMALL_MODULO = 1u << 16;
+
+    // Side of the square blocks processed by the operations, so that a transposed operand is read by whole cache lines
+    static constexpr unsigned BLOCK = 32;
+
+    // Cost of the reduction of an accumulator of the product, relative to a multiply-add
+    static constexpr double REDUCTION_COST = 8;
     // endregion
 
     // region Private methods
@@ -22,18 +93,132 @@ private:
     /**
     * @brief Applies a specified operation to the current matrix with another matrix.
     * @param other The other matrix to operate with.
-    * @param op The operation to apply.
+    * @param op The function computing an element of the result from the two reduced elements at its position (0
+    * outside of a matrix), with a 64 bits intermediate when the modulo needs it.
+    * @param operand Whether the other matrix is used as is or transposed.
     */
-    void applyOperator(const Matrix &other, const Operator &op);
+    template<typename ElementFunction>
+    void applyOperator(const Matrix &other, ElementFunction op, Operand operand);
 
     /**
-     * @brief Frees the memory allocated for a 2D array and resets its dimensions.
-     * @note The pointer to the 2D array is set to nullptr and the dimensions are reset to 0.
-     * @param dataToFree A reference to the pointer to the 2D array that needs to be freed.
-     * @param dataRows A reference to the variable holding the number of rows in the 2D array.
-     * @param dataCols A reference to the variable holding the number of columns in the 2D array.
-     */
-    static void freeMemory(unsigned** &dataToFree, unsigned& dataRows, unsigned& dataCols) ;
+    * @brief Computes each element from its value and the values at the same position in up to two other matrices,
+    * in a single pass without temporary matrix.
+    * @param first The first other matrix, nullptr if not used.
+    * @param second The second other matrix, nullptr if not used.
+    * @param op The function computing the new value of an element from the 3 values (0 outside of a matrix).
+    * @throws std::invalid_argument if the modulo of the matrices are different.
+    * @throws std::runtime_error if the data of a matrix is null.
+    */
+    template<typename ElementFunction>
+    void applyFused(const Matrix *first, const Matrix *second, ElementFunction op);
+
+    /**
+    * @brief Computes each element from its value and the element of a vector repeated along the rows or the columns,
+    * in a single pass: the vector is read from the cache, it is neither padded nor copied.
+    * @param vector The repeated vector.
+    * @param axis Whether the vector is a row or a column.
+    * @param op The function computing the new value of an element from its value and the one of the vector.
+    * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+    * @throws std::runtime_error if the data of the matrix is null.
+    */
+    template<typename ElementFunction>
+    void applyBroadcast(const Vector &vector, Axis axis, ElementFunction op);
+
+    /**
+    * @brief Writes the matrix product of this matrix with another one to a buffer, the rows are split across threads.
+    * @param other The right-hand side matrix, its inner dimension must match.
+    * @param transposed Whether the other matrix is used transposed.
+    * @param elements The elements of the result, must not overlap the operands.
+    */
+    void productInto(const Matrix &other, bool transposed, unsigned *elements) const;
+
+    /**
+    * @brief Writes the products of this matrix with several column vectors to their results, the matrix is streamed
+    * once and its rows are split across threads. The vectors are read in place, neither copied nor gathered.
+    * @param vectors The elements of each vector, as many as the columns of this matrix.
+    * @param results The elements of each result, as many as the rows of this matrix.
+    * @param count The number of vectors.
+    */
+    void vectorProductsInto(const unsigned *const *vectors, unsigned *const *results, std::size_t count) const;
+
+    /**
+    * @brief Checks that a vector can be multiplied by this matrix.
+    * @param vector The right-hand side vector.
+    * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+    */
+    void checkProductVector(const Vector &vector) const;
+
+    /**
+    * @brief Checks that the matrices of a chain can be multiplied one after the other and gets their dimensions.
+    * @param operands The matrices of the chain.
+    * @return The number of rows of each matrix, followed by the number of columns of the last one.
+    * @throws std::invalid_argument if the chain is empty, or the modulo or the dimensions of the matrices mismatch.
+    */
+    static std::vector<unsigned> chainDimensions(const std::vector<std::reference_wrapper<const Matrix>> &operands);
+
+    /**
+    * @brief Finds the order of a chain of products of minimal cost, with the dynamic programming algorithm.
+    * @param dimensions The number of rows of each matrix of the chain, followed by the number of columns of the last one.
+    * @param modulo The modulo of the matrices.
+    * @param splits Where the position after which the chain [i, j] is split is written, at i * count + j.
+    * @return The cost of the whole chain.
+    */
+    static double chainOrder(const std::vector<unsigned> &dimensions, unsigned modulo, std::vector<std::size_t> &splits);
+
+    /**
+    * @brief Raises this N x N matrix to a power with the intermediate matrices on the stack, for small matrices.
+    * @param exponent The power.
+    * @param elements The elements of the result.
+    */
+    template<unsigned N>
+    void powFixed(uint64_t exponent, unsigned *elements) const;
+
+    /**
+    * @brief Reduces all the elements, the ranges of elements are reduced in parallel then combined.
+    * @param identity The value of the reduction of no element.
+    * @param reduceRange The function reducing the elements [first, last) of the buffer to a partial value.
+    * @param combine The function combining two partial values.
+    * @return The reduction of all the elements.
+    * @throws std::runtime_error if the data of the matrix is null.
+    */
+    template<typename T, typename RangeReduction, typename Combination>
+    T reduceElements(T identity, RangeReduction reduceRange, Combination combine) const;
+
+    /**
+    * @brief Checks that the matrix holds elements, i.e. it was not moved.
+    * @throws std::runtime_error if the data of the matrix is null.
+    */
+    void checkData() const;
+
+    /**
+    * @brief Records that the elements of a region were written in a new generation, merged with the last change
+    * when possible.
+    * @param region The written region.
+    */
+    void markDirty(const Region &region);
+
+    /** @brief Records that the whole matrix was written in a new generation. */
+    void markAllDirty() noexcept {
+        truncatedGeneration = ++generation;
+        changes.clear();
+    }
+
+    /**
+    * @brief Hashes an array of elements in 16 independent 32 bits lanes that the compiler maps to SIMD registers.
+    * @param elements The elements.
+    * @param count The number of elements.
+    * @return The hash of the elements, never 0.
+    */
+    static uint64_t hashElements(const unsigned *elements, std::size_t count);
+
+    /**
+    * @brief Compares two arrays of elements by blocks, each block in independent lanes mapped to SIMD registers.
+    * @param lhs The left elements.
+    * @param rhs The right elements.
+    * @param count The number of elements of each array.
+    * @return Whether all the elements are equal.
+    */
+    static bool elementsEqual(const unsigned *lhs, const unsigned *rhs, std::size_t count);
 
     /**
     * @brief Checks the bounds of the matrix and retrieves the value at the specified indices.
@@ -44,11 +229,31 @@ private:
     [[nodiscard]] unsigned checkBounds(unsigned rowIndex, unsigned columnIndex) const;
 
     /**
-     * @brief Copies the data from another matrix to the current matrix.
-     * @param other The matrix to copy from.
-     * @return A pointer to the new data array.
+     * @brief Gives a direct access to the elements of a row, used by the other matrix representations.
+     * @note The elements are first duplicated if they are shared with a copy of the matrix.
+     * @param rowIndex The row index, must be lower than the number of rows.
+     * @return A pointer to the first element of the row.
+     */
+    [[nodiscard]] unsigned *rowData(unsigned rowIndex) { return data.mutableData() + std::size_t(rowIndex) * columns; }
+
+    /**
+     * @brief Gives a read-only access to the elements of a row, used by the other matrix representations.
+     * @param rowIndex The row index, must be lower than the number of rows.
+     * @return A pointer to the first element of the row.
      */
-    [[nodiscard]] unsigned** copyData(const Matrix &other);
+    [[nodiscard]] const unsigned *rowData(unsigned rowIndex) const {
+        return data.data() + std::size_t(rowIndex) * columns;
+    }
+
+    /**
+    * @brief Constructs a Matrix whose elements are initialized according to the given fill mode.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param modulo The modulo value for matrix operations.
+    * @param fill How the elements must be initialized.
+    * @param resource The memory resource providing the elements.
+    */
+    Matrix(unsigned rows, unsigned columns, unsigned modulo, Fill fill, std::pmr::memory_resource *resource);
 
     // endregion
 
@@ -64,8 +269,23 @@ public:
     */
     Matrix(unsigned rows, unsigned columns, unsigned modulo);
 
+    /**
+    * @brief Constructs a Matrix filled with random numbers in the range [0, modulo), whose elements are allocated
+    * from the given memory resource.
+    * The results of the operations on this matrix are allocated from the same resource, so a pooling resource such as
+    * BufferPool reuses the buffers of the temporaries instead of calling the global allocator.
+    * @note The resource must outlive the matrix and all the matrices sharing or computed from its elements.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param modulo The modulo value for matrix operations.
+    * @param resource The memory resource providing the elements.
+    */
+    Matrix(unsigned rows, unsigned columns, unsigned modulo, std::pmr::memory_resource *resource);
+
     /**
     * @brief Copy constructor.
+    * @note In O(1) when copy-on-write is enabled on the other matrix: the elements are shared until one of the two
+    * matrices is modified.
     * @param other The Matrix object to copy from.
     */
     Matrix(const Matrix &other);
@@ -78,10 +298,85 @@ public:
 
     /** @brief Destructor that frees allocated memory. */
     ~Matrix();
+
+    /**
+    * @brief Creates a Matrix whose elements are all 0.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param modulo The modulo value for matrix operations.
+    * @param resource The memory resource providing the elements, the default resource if not given.
+    * @return The zero matrix.
+    */
+    static Matrix zeros(unsigned rows, unsigned columns, unsigned modulo,
+                        std::pmr::memory_resource *resource = std::pmr::get_default_resource());
     // endregion
 
     // region Public methods
 
+    /** @return The number of rows of the matrix. */
+    [[nodiscard]] unsigned getRows() const { return rows; }
+
+    /** @return The number of columns of the matrix. */
+    [[nodiscard]] unsigned getColumns() const { return columns; }
+
+    /** @return The modulo applied to the elements of the matrix. */
+    [[nodiscard]] unsigned getModulo() const { return modulo; }
+
+    /** @return The memory resource providing the elements of the matrix, nullptr if the matrix was moved. */
+    [[nodiscard]] std::pmr::memory_resource *getResource() const { return data.resource(); }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    [[nodiscard]] unsigned get(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Sets the value of an element, and records it as a dirty region.
+     * @note The elements are duplicated first if they are shared with a copy (copy-on-write).
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @param value The value, reduced modulo n.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    void set(unsigned rowIndex, unsigned columnIndex, unsigned value);
+
+    /**
+     * @brief Sets the values of a row, and records it as a dirty region.
+     * @note The elements are duplicated first if they are shared with a copy (copy-on-write).
+     * @param rowIndex The row index.
+     * @param values The values of the row, reduced modulo n.
+     * @throws std::out_of_range if the row is outside the matrix.
+     * @throws std::invalid_argument if the number of values is not the number of columns.
+     */
+    void setRow(unsigned rowIndex, const std::vector<unsigned> &values);
+
+    /** @return The generation of the matrix, incremented by each modification. */
+    [[nodiscard]] uint64_t getGeneration() const noexcept { return generation; }
+
+    /**
+     * @brief Gets the regions written after a generation. set() and setRow() record the elements they write, any
+     * other modification of the matrix (in-place operation, assignment) the whole matrix. Each reader keeps the
+     * generation it last read, so any number of them can follow the same matrix.
+     * @param since The generation already read, as returned by getGeneration().
+     * @return The dirty regions, they may overlap and cover more elements than the ones written.
+     */
+    [[nodiscard]] std::vector<Region> getDirtyRegions(uint64_t since) const;
+
+    /**
+     * @brief Enables or disables copy-on-write for the copies of this matrix (enabled by default).
+     * When enabled, a copy shares the elements of this matrix and duplicates them only before its first
+     * modification. When disabled, a copy duplicates the elements immediately.
+     * @param enabled true to share the elements with the copies, false to duplicate them.
+     */
+    void setCopyOnWrite(bool enabled) { copyOnWrite = enabled; }
+
+    /** @return true if the elements of this matrix are currently shared with another matrix, false otherwise. */
+    [[nodiscard]] bool isShared() const { return data.isShared(); }
+
     /**
      * @brief Adds another matrix to this matrix in-place.
      * @param other The matrix to be added to this matrix.
@@ -89,13 +384,22 @@ public:
      */
     Matrix &add(const Matrix &other);
 
+    /**
+     * @brief Adds another matrix, or its transpose, to this matrix in-place.
+     * @param other The matrix to be added to this matrix.
+     * @param operand Whether the other matrix is used as is or transposed.
+     * @return A reference to this matrix after the addition.
+     */
+    Matrix &add(const Matrix &other, Operand operand);
+
     /**
      * @brief Creates a new matrix that is the result of adding another matrix to this matrix.
      * Does not modify the current matrix. Instead, returns a new Matrix instance that is the result of the addition.
      * @param other The matrix to be added to this matrix.
+     * @param operand Whether the other matrix is used as is or transposed.
      * @return A new Matrix instance that is the result of the addition.
      */
-    [[nodiscard]] Matrix addStatic(const Matrix &other) const;
+    [[nodiscard]] Matrix addStatic(const Matrix &other, Operand operand = Operand::Normal) const;
 
     /**
      * @brief Dynamically allocates a new matrix that is the result of adding another matrix to this matrix.
@@ -113,13 +417,22 @@ public:
      */
     Matrix &sub(const Matrix &other);
 
+    /**
+     * @brief Subtracts another matrix, or its transpose, to this matrix in-place.
+     * @param other The matrix to be subtracted to this matrix.
+     * @param operand Whether the other matrix is used as is or transposed.
+     * @return A reference to this matrix after the subtraction.
+     */
+    Matrix &sub(const Matrix &other, Operand operand);
+
     /**
      * @brief Creates a new matrix that is the result of subtracting another matrix to this matrix.
      * Does not modify the current matrix. Instead, returns a new Matrix instance that is the result of the subtraction.
      * @param other The matrix to be subtracted to this matrix.
+     * @param operand Whether the other matrix is used as is or transposed.
      * @return A new Matrix instance that is the result of the subtraction.
      */
-    [[nodiscard]] Matrix subStatic(const Matrix &other) const;
+    [[nodiscard]] Matrix subStatic(const Matrix &other, Operand operand = Operand::Normal) const;
 
     /**
      * @brief Dynamically allocates a new matrix that is the result of subtracting another matrix to this matrix.
@@ -137,13 +450,22 @@ public:
      */
     Matrix &multiply(const Matrix &other);
 
+    /**
+     * @brief Multiplies another matrix, or its transpose, to this matrix in-place.
+     * @param other The matrix to be multiplied to this matrix.
+     * @param operand Whether the other matrix is used as is or transposed.
+     * @return A reference to this matrix after the multiplication.
+     */
+    Matrix &multiply(const Matrix &other, Operand operand);
+
     /**
      * @brief Creates a new matrix that is the result of multiplying another matrix to this matrix.
      * Does not modify the current matrix. Instead, returns a new Matrix instance that is the result of the multiplication.
      * @param other The matrix to be multiplied to this matrix.
+     * @param operand Whether the other matrix is used as is or transposed.
      * @return A new Matrix instance that is the result of the multiplication.
      */
-    [[nodiscard]] Matrix multiplyStatic(const Matrix &other) const;
+    [[nodiscard]] Matrix multiplyStatic(const Matrix &other, Operand operand = Operand::Normal) const;
 
     /**
      * @brief Dynamically allocates a new matrix that is the result of multiplying another matrix to this matrix.
@@ -154,6 +476,313 @@ public:
      */
     [[nodiscard]] Matrix *multiplyDynamic(const Matrix &other) const;
 
+    /**
+     * @brief Computes the matrix product of this matrix with another one.
+     * The 64 bits accumulators of a row of the result are reduced only when they could overflow, and the rows are
+     * split across threads. With a transposed operand, each element is the dot product of two rows, both read
+     * contiguously.
+     * @param other The right-hand side matrix.
+     * @param operand Whether the other matrix is used as is or transposed.
+     * @return A new Matrix instance that is the result of the product.
+     * @throws std::invalid_argument if the modulo or the inner dimensions are different.
+     */
+    [[nodiscard]] Matrix product(const Matrix &other, Operand operand = Operand::Normal) const;
+
+    /**
+     * @brief Computes the product of this matrix with a column vector (GEMV).
+     * The matrix is streamed once, each row being the dot product of Modular::dot with the vector, and the rows are
+     * split in bands across threads.
+     * @param vector The right-hand side vector, its size must be the number of columns of this matrix.
+     * @return A new Vector instance with one element per row of this matrix.
+     * @throws std::invalid_argument if the modulo or the dimensions are different.
+     */
+    [[nodiscard]] Vector product(const Vector &vector) const;
+
+    /**
+     * @brief Computes the products of this matrix with several column vectors, the matrix is streamed only once.
+     * Each row is multiplied by all the vectors while it is in the cache.
+     * @param vectors The right-hand side vectors, their size must be the number of columns of this matrix.
+     * @return A new Vector instance per vector, with one element per row of this matrix.
+     * @throws std::invalid_argument if the modulo or the dimensions of a vector are different.
+     */
+    [[nodiscard]] std::vector<Vector> product(const std::vector<Vector> &vectors) const;
+
+    /**
+     * @brief Raises this square matrix to a power with respect to the matrix product, by repeated squaring.
+     * The products are written alternately to three buffers allocated once, and the matrices up to 4 x 4 are raised
+     * on the stack.
+     * @param exponent The power, the power 0 is the identity matrix.
+     * @return A new Matrix instance that is the result of the exponentiation.
+     * @throws std::invalid_argument if the matrix is not square.
+     */
+    [[nodiscard]] Matrix pow(uint64_t exponent) const;
+
+    /**
+     * @brief Estimates the cost of the product of a rows x inner matrix and a inner x columns matrix with the kernel
+     * of product(): one multiply-add per triple, plus the reductions of the accumulators delayed as long as they
+     * cannot overflow, which depends on the modulo.
+     * @param rows The number of rows of the left matrix.
+     * @param inner The number of columns of the left matrix.
+     * @param columns The number of columns of the right matrix.
+     * @param modulo The modulo of the matrices.
+     * @return The cost of the product, in multiply-adds.
+     */
+    [[nodiscard]] static double productCost(unsigned rows, unsigned inner, unsigned columns, unsigned modulo);
+
+    /**
+     * @brief Estimates the cost of the product of a chain of matrices in its cheapest order (see productCost).
+     * @param operands The matrices of the chain, from left to right.
+     * @return The cost of the chain, in multiply-adds.
+     * @throws std::invalid_argument if the chain is empty, or the modulo or the dimensions of the matrices mismatch.
+     */
+    [[nodiscard]] static double chainCost(const std::vector<std::reference_wrapper<const Matrix>> &operands);
+
+    /**
+     * @brief Computes the product of a chain of matrices, in the order of the products of minimal cost.
+     * The order is found by dynamic programming over productCost, then the products are computed from the leaves
+     * of the order, each intermediate result being written to the buffer of a consumed one when it is large enough.
+     * @param operands The matrices of the chain, from left to right.
+     * @return A new Matrix instance that is the product of the chain.
+     * @throws std::invalid_argument if the chain is empty, or the modulo or the dimensions of the matrices mismatch.
+     * @throws std::runtime_error if the data of a matrix is null.
+     */
+    [[nodiscard]] static Matrix chainProduct(const std::vector<std::reference_wrapper<const Matrix>> &operands);
+
+    // region Linear algebra
+
+    /**
+     * @brief Computes the rank of this matrix by Gaussian elimination (see LUDecomposition).
+     * @return The rank of the matrix.
+     * @throws std::invalid_argument if the modulo is not prime.
+     */
+    [[nodiscard]] unsigned rank() const;
+
+    /**
+     * @brief Computes the determinant of this square matrix by Gaussian elimination (see LUDecomposition).
+     * @return The determinant modulo n.
+     * @throws std::invalid_argument if the modulo is not prime or the matrix is not square.
+     */
+    [[nodiscard]] unsigned determinant() const;
+
+    /**
+     * @brief Computes the inverse of this square matrix by Gaussian elimination (see LUDecomposition).
+     * @return A new Matrix instance that is the inverse of this matrix.
+     * @throws std::invalid_argument if the modulo is not prime or the matrix is not square.
+     * @throws std::runtime_error if the matrix is singular.
+     */
+    [[nodiscard]] Matrix inverse() const;
+
+    /**
+     * @brief Solves the linear systems this * X = B, one for each column of B (see LUDecomposition).
+     * @param rhs The right-hand sides B, with as many rows as this matrix.
+     * @return A new Matrix instance that is the solution X.
+     * @throws std::invalid_argument if the modulo is not prime, this matrix is not square, or the modulo or the number
+     * of rows of B are different.
+     * @throws std::runtime_error if the matrix is singular.
+     */
+    [[nodiscard]] Matrix solve(const Matrix &rhs) const;
+    // endregion
+
+    /**
+     * @brief Creates the transpose of this matrix, using a cache-oblivious recursive kernel.
+     * @return A new Matrix instance that is the transpose of this matrix.
+     */
+    [[nodiscard]] Matrix transpose() const;
+
+    /**
+     * @brief Transposes this square matrix in-place, using a cache-oblivious recursive kernel.
+     * @return A reference to this matrix after the transposition.
+     * @throws std::invalid_argument if the matrix is not square.
+     */
+    Matrix &transposeInPlace();
+
+    // region Fused operations
+
+    /**
+     * @brief Multiplies (component by component) this matrix by another one and adds a third one, in-place and in a
+     * single pass: this = this * factor + addend, with a single modular reduction per element.
+     * @param factor The matrix to be multiplied to this matrix.
+     * @param addend The matrix to be added to the product.
+     * @return A reference to this matrix after the operation.
+     */
+    Matrix &multiplyAdd(const Matrix &factor, const Matrix &addend);
+
+    /**
+     * @brief Creates a new matrix that is the component by component product of this matrix and another one, plus a
+     * third one, computed in a single pass.
+     * @param factor The matrix to be multiplied to this matrix.
+     * @param addend The matrix to be added to the product.
+     * @return A new Matrix instance that is the result of the operation.
+     */
+    [[nodiscard]] Matrix multiplyAddStatic(const Matrix &factor, const Matrix &addend) const;
+
+    /**
+     * @brief Adds a scalar to each element of this matrix in-place.
+     * @param scalar The value to be added, reduced modulo n first.
+     * @return A reference to this matrix after the addition.
+     */
+    Matrix &addScalar(unsigned scalar);
+
+    /**
+     * @brief Creates a new matrix that is the result of adding a scalar to each element of this matrix.
+     * @param scalar The value to be added, reduced modulo n first.
+     * @return A new Matrix instance that is the result of the addition.
+     */
+    [[nodiscard]] Matrix addScalarStatic(unsigned scalar) const;
+
+    /**
+     * @brief Multiplies each element of this matrix by a scalar in-place.
+     * @param scalar The value to be multiplied, reduced modulo n first.
+     * @return A reference to this matrix after the multiplication.
+     */
+    Matrix &multiplyScalar(unsigned scalar);
+
+    /**
+     * @brief Creates a new matrix that is the result of multiplying each element of this matrix by a scalar.
+     * @param scalar The value to be multiplied, reduced modulo n first.
+     * @return A new Matrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] Matrix multiplyScalarStatic(unsigned scalar) const;
+
+    /**
+     * @brief Adds a multiple of another matrix to this matrix in-place and in a single pass (this = alpha * x + this),
+     * with a single modular reduction per element.
+     * @param alpha The factor of the other matrix, reduced modulo n first.
+     * @param x The matrix whose multiple is added to this matrix.
+     * @return A reference to this matrix after the operation.
+     */
+    Matrix &axpy(unsigned alpha, const Matrix &x);
+
+    /**
+     * @brief Creates a new matrix that is the result of adding a multiple of another matrix to this matrix.
+     * @param alpha The factor of the other matrix, reduced modulo n first.
+     * @param x The matrix whose multiple is added to this matrix.
+     * @return A new Matrix instance that is the result of the operation (alpha * x + this).
+     */
+    [[nodiscard]] Matrix axpyStatic(unsigned alpha, const Matrix &x) const;
+
+    /**
+     * @brief Adds a vector to each row or each column of this matrix in-place.
+     * @param vector The vector to be added, its size must be the number of columns (row) or rows (column).
+     * @param axis Whether the vector is a row or a column.
+     * @return A reference to this matrix after the addition.
+     * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+     */
+    Matrix &addBroadcast(const Vector &vector, Axis axis);
+
+    /**
+     * @brief Creates a new matrix that is the result of adding a vector to each row or each column of this matrix.
+     * @param vector The vector to be added, its size must be the number of columns (row) or rows (column).
+     * @param axis Whether the vector is a row or a column.
+     * @return A new Matrix instance that is the result of the addition.
+     * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+     */
+    [[nodiscard]] Matrix addBroadcastStatic(const Vector &vector, Axis axis) const;
+
+    /**
+     * @brief Subtracts a vector to each row or each column of this matrix in-place.
+     * @param vector The vector to be subtracted, its size must be the number of columns (row) or rows (column).
+     * @param axis Whether the vector is a row or a column.
+     * @return A reference to this matrix after the subtraction.
+     * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+     */
+    Matrix &subBroadcast(const Vector &vector, Axis axis);
+
+    /**
+     * @brief Creates a new matrix that is the result of subtracting a vector to each row or each column of this
+     * matrix.
+     * @param vector The vector to be subtracted, its size must be the number of columns (row) or rows (column).
+     * @param axis Whether the vector is a row or a column.
+     * @return A new Matrix instance that is the result of the subtraction.
+     * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+     */
+    [[nodiscard]] Matrix subBroadcastStatic(const Vector &vector, Axis axis) const;
+
+    /**
+     * @brief Multiplies (component by component) each row or each column of this matrix by a vector in-place, i.e.
+     * scales the columns (row vector) or the rows (column vector).
+     * @param vector The vector to be multiplied, its size must be the number of columns (row) or rows (column).
+     * @param axis Whether the vector is a row or a column.
+     * @return A reference to this matrix after the multiplication.
+     * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+     */
+    Matrix &multiplyBroadcast(const Vector &vector, Axis axis);
+
+    /**
+     * @brief Creates a new matrix that is the result of multiplying (component by component) each row or each column
+     * of this matrix by a vector.
+     * @param vector The vector to be multiplied, its size must be the number of columns (row) or rows (column).
+     * @param axis Whether the vector is a row or a column.
+     * @return A new Matrix instance that is the result of the multiplication.
+     * @throws std::invalid_argument if the modulo or the size of the vector does not match.
+     */
+    [[nodiscard]] Matrix multiplyBroadcastStatic(const Vector &vector, Axis axis) const;
+
+    /**
+     * @brief Raises each element of this matrix to a power in-place (Hadamard power), in a single pass.
+     * The powers use square-and-multiply, in Montgomery form when the modulo is odd.
+     * @param exponent The power, 0^0 is 1.
+     * @return A reference to this matrix after the operation.
+     */
+    Matrix &powElements(uint64_t exponent);
+
+    /**
+     * @brief Creates a new matrix whose elements are the elements of this matrix raised to a power.
+     * @param exponent The power, 0^0 is 1.
+     * @return A new Matrix instance that is the result of the operation.
+     */
+    [[nodiscard]] Matrix powElementsStatic(uint64_t exponent) const;
+    // endregion
+
+    // region Reductions
+
+    /**
+     * @brief Computes the sum of all the elements, using 64 bits accumulators reduced only when they could overflow.
+     * @return The sum modulo n.
+     */
+    [[nodiscard]] unsigned sum() const;
+
+    /**
+     * @brief Computes the sum of the elements of the main diagonal (of a rectangular matrix, the square part of it).
+     * @return The trace modulo n.
+     */
+    [[nodiscard]] unsigned trace() const;
+
+    /**
+     * @brief Computes the sum of each row.
+     * @return The sums modulo n, one per row.
+     */
+    [[nodiscard]] std::vector<unsigned> rowSums() const;
+
+    /**
+     * @brief Computes the sum of each column, the rows are accumulated in parallel into partial sums.
+     * @return The sums modulo n, one per column.
+     */
+    [[nodiscard]] std::vector<unsigned> columnSums() const;
+
+    /** @return The smallest element of the matrix. */
+    [[nodiscard]] unsigned min() const;
+
+    /** @return The largest element of the matrix. */
+    [[nodiscard]] unsigned max() const;
+
+    /**
+     * @brief Counts the elements equal to a value.
+     * @param value The value to look for.
+     * @return The number of elements equal to the value.
+     */
+    [[nodiscard]] std::size_t count(unsigned value) const;
+
+    /**
+     * @brief Computes a hash of the dimensions, the modulo and the elements of the matrix.
+     * The hash of the elements is remembered by the buffer, with all the copies sharing it, until it is written: the
+     * hash of an unchanged matrix is only computed once.
+     * @return The hash, equal for equal matrices.
+     * @throws std::runtime_error if the data of the matrix is null.
+     */
+    [[nodiscard]] uint64_t hash() const;
+    // endregion
+
     // endregion
 
     // region Operators
@@ -180,6 +809,23 @@ public:
     * @return A reference to the modified output stream.
     */
     friend std::ostream &operator<<(std::ostream &os, const Matrix &matrix);
+
+    /**
+    * @brief Equality operator, the matrices are equal if they have the same dimensions, modulo and elements.
+    * The elements are not read when the buffer is shared, or when the remembered hashes differ.
+    * @param lhs The left-hand side matrix.
+    * @param rhs The right-hand side matrix.
+    * @return Whether the matrices are equal.
+    */
+    friend bool operator==(const Matrix &lhs, const Matrix &rhs);
+
+    /**
+    * @brief Inequality operator, the negation of operator==.
+    * @param lhs The left-hand side matrix.
+    * @param rhs The right-hand side matrix.
+    * @return Whether the matrices are different.
+    */
+    friend bool operator!=(const Matrix &lhs, const Matrix &rhs);
     // endregion
 };
 
@@ -0,0 +1,115 @@
+#include "PageResource.hpp"
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // Smallest page size of the supported platforms
+    constexpr std::size_t PAGE_SIZE = 4096;
+
+    // Policy of mbind from <numaif.h>, not included to avoid the dependency on libnuma
+    constexpr int MPOL_INTERLEAVE_MODE = 3;
+}
+
+// region Ctors and Destructor
+
+PageResource::PageResource() : PageResource(Policy{}) {}
+
+PageResource::PageResource(Policy policy, std::pmr::memory_resource *upstream) : policy(policy), upstream(upstream) {}
+// endregion
+
+// region Public methods
+
+bool PageResource::isSupported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+// endregion
+
+// region memory_resource
+
+void *PageResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    if (!isMapped(bytes, alignment)) {
+        return upstream->allocate(bytes, alignment);
+    }
+
+#ifdef __linux__
+    const std::size_t size = mappingSize(bytes);
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+    // The pages are faulted in now, by this thread, unless they are left to the first write of the row chunks
+    if (!policy.firstTouch && !policy.interleave) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+    void *memory = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (policy.hugePages == HugePages::Explicit) {
+        // Fails when no huge page is reserved, the transparent huge pages are used instead
+        memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    const bool explicitHugePages = memory != MAP_FAILED;
+    if (!explicitHugePages) {
+        memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+    }
+
+    // The advices only change the placement of the pages, an error leaves the default placement
+#ifdef MADV_HUGEPAGE
+    if (!explicitHugePages && policy.hugePages != HugePages::None) {
+        madvise(memory, size, MADV_HUGEPAGE);
+    }
+#endif
+#ifdef SYS_mbind
+    if (policy.interleave) {
+        // Every node, the kernel keeps the ones that are online and allowed to the process
+        const unsigned long nodes = ~0ul;
+        syscall(SYS_mbind, memory, size, MPOL_INTERLEAVE_MODE, &nodes, sizeof(nodes) * 8, 0);
+    }
+#endif
+    return memory;
+#else
+    return upstream->allocate(bytes, alignment);
+#endif
+}
+
+void PageResource::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) {
+    if (!isMapped(bytes, alignment)) {
+        upstream->deallocate(pointer, bytes, alignment);
+        return;
+    }
+
+#ifdef __linux__
+    munmap(pointer, mappingSize(bytes));
+#else
+    upstream->deallocate(pointer, bytes, alignment);
+#endif
+}
+
+bool PageResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+// endregion
+
+// region Private methods
+
+bool PageResource::isMapped(std::size_t bytes, std::size_t alignment) const {
+    return bytes >= policy.threshold && alignment <= PAGE_SIZE;
+}
+
+std::size_t PageResource::mappingSize(std::size_t bytes) const {
+    // A mapping of explicit huge pages must be a multiple of their size, the fallback mapping uses the same length
+    const std::size_t granularity = policy.hugePages == HugePages::None ? PAGE_SIZE : HUGE_PAGE_SIZE;
+    return (bytes + granularity - 1) / granularity * granularity;
+}
+// endregion
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * @class PageResource
+ * @brief Memory resource mapping the large buffers directly from the system, with huge pages and NUMA placement.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The buffers of at least Policy::threshold bytes are mapped with mmap, the others are forwarded to the upstream
+ * resource. A mapping can be backed by transparent huge pages (madvise) or explicit huge pages (MAP_HUGETLB, with a
+ * fallback to transparent huge pages when none is reserved), which divides the TLB misses of the large operands.
+ * Its pages can be interleaved over the NUMA nodes, or left untouched so that they are placed by their first write: the
+ * Matrix fill and the element-wise kernels write the rows in the same chunks (the grain of Tuning::elementGrain()), so
+ * with Parallel::setPinning each thread finds the rows it processes on its own node. Without pinning, or for the pages
+ * straddling two chunks, the placement is only best-effort.
+ * @note Mapping the memory is only implemented on Linux, elsewhere every buffer is given by the upstream resource.
+ */
+class PageResource : public std::pmr::memory_resource {
+public:
+    /** @brief Defines which pages back a mapping. */
+    enum class HugePages {
+        None,        // Normal pages
+        Transparent, // Normal pages that the kernel may merge into huge pages (madvise MADV_HUGEPAGE)
+        Explicit     // Huge pages reserved by the system administrator (MAP_HUGETLB)
+    };
+
+    /** @brief Defines how the large buffers are allocated. */
+    struct Policy {
+        HugePages hugePages = HugePages::Transparent;
+        // Distributes the pages over all the NUMA nodes, in round robin
+        bool interleave = false;
+        // Leaves the pages to be placed by the first write of the row chunks, otherwise all the pages are faulted in by
+        // the allocating thread (on its node) with the mapping; ignored when interleaving
+        bool firstTouch = true;
+        // Minimum size in bytes of a mapped buffer
+        std::size_t threshold = std::size_t(1) << 20;
+    };
+
+    // Size of a huge page on x86-64 and AArch64 with 4K pages
+    static constexpr std::size_t HUGE_PAGE_SIZE = std::size_t(2) << 20;
+
+    // region Ctors and Destructor
+
+    /** @brief Constructs a resource with the default policy. */
+    PageResource();
+
+    /**
+     * @brief Constructs a resource allocating the large buffers according to a policy.
+     * @param policy The allocation policy.
+     * @param upstream The resource providing the buffers smaller than the threshold.
+     */
+    explicit PageResource(Policy policy, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+
+    PageResource(const PageResource &) = delete;
+
+    PageResource &operator=(const PageResource &) = delete;
+
+    ~PageResource() override = default;
+    // endregion
+
+    // region Public methods
+
+    /** @return The allocation policy. */
+    [[nodiscard]] const Policy &getPolicy() const { return policy; }
+
+    /** @return true if the large buffers are mapped from the system on this platform, false otherwise. */
+    [[nodiscard]] static bool isSupported();
+    // endregion
+
+protected:
+    // region memory_resource
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+    // endregion
+
+private:
+    const Policy policy;
+    std::pmr::memory_resource *upstream;
+
+    /**
+     * @brief Checks if a buffer is mapped from the system or given by the upstream resource.
+     * @param bytes The size of the buffer in bytes.
+     * @param alignment The alignment of the buffer.
+     * @return true if the buffer is mapped, false otherwise.
+     */
+    [[nodiscard]] bool isMapped(std::size_t bytes, std::size_t alignment) const;
+
+    /**
+     * @brief Gets the length of the mapping of a buffer, a multiple of the page size.
+     * @param bytes The size of the buffer in bytes.
+     * @return The length of the mapping in bytes.
+     */
+    [[nodiscard]] std::size_t mappingSize(std::size_t bytes) const;
+};
@@ -0,0 +1,81 @@
+#include "SharedBuffer.hpp"
+#include <cstring>
+#include <utility>
+
+// region Constructors and Destructor
+
+SharedBuffer::SharedBuffer(std::size_t size, std::pmr::memory_resource *resource) : block(allocate(size, resource)) {}
+
+SharedBuffer::SharedBuffer(const SharedBuffer &other) noexcept: block(other.block) {
+    if (block) {
+        // Nothing is published through the count itself, so the increment needs no ordering
+        block->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+SharedBuffer::SharedBuffer(SharedBuffer &&other) noexcept: block(std::exchange(other.block, nullptr)) {}
+
+SharedBuffer::~SharedBuffer() {
+    release();
+}
+// endregion
+
+// region Public Methods
+
+unsigned *SharedBuffer::mutableData() {
+    if (isShared()) {
+        *this = clone();
+    }
+    if (block) {
+        // The elements are about to change, the remembered hash would be stale
+        block->hash.store(0, std::memory_order_relaxed);
+    }
+    return elements(block);
+}
+
+bool SharedBuffer::isShared() const {
+    // Acquire pairs with the release of the other references, so their reads are done before this buffer is written
+    return block && block->references.load(std::memory_order_acquire) > 1;
+}
+
+SharedBuffer SharedBuffer::clone() const {
+    if (!block) {
+        return {};
+    }
+
+    SharedBuffer result(block->size, block->resource);
+    std::memcpy(elements(result.block), elements(block), block->size * sizeof(unsigned));
+    result.rememberHash(rememberedHash());
+    return result;
+}
+// endregion
+
+// region Operators
+
+SharedBuffer &SharedBuffer::operator=(SharedBuffer other) noexcept {
+    std::swap(block, other.block);
+    return *this;
+}
+// endregion
+
+// region Private Methods
+
+SharedBuffer::Block *SharedBuffer::allocate(std::size_t size, std::pmr::memory_resource *resource) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    void *memory = resource->allocate(HEADER_SIZE + size * sizeof(unsigned), ALIGNMENT);
+    return new(memory) Block{{1}, size, resource, {0}};
+}
+
+void SharedBuffer::release() noexcept {
+    if (block && block->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::pmr::memory_resource *resource = block->resource;
+        const std::size_t bytes = HEADER_SIZE + block->size * sizeof(unsigned);
+        block->~Block();
+        resource->deallocate(block, bytes, ALIGNMENT);
+    }
+    block = nullptr;
+}
+// endregion
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+/**
+ * @class SharedBuffer
+ * @brief Reference counted array of elements, shared between copies until one of them is modified (copy-on-write).
+ * @authors Slimani Walid, Van Hove Timothée
+ * Copying a SharedBuffer is O(1): only the reference count is incremented. The elements are duplicated by
+ * mutableData() the first time a copy is written while other copies still reference them. The reference count is
+ * atomic, so copies of the same buffer can be used and released from different threads.
+ * The reference count and the elements are obtained from a std::pmr::memory_resource in a single allocation, so a
+ * pooling resource (see BufferPool) can take the allocator out of the loops creating temporary matrices.
+ */
+class SharedBuffer {
+private:
+    /** @brief Shared state of the buffer, stored right before the elements and referenced by all the copies. */
+    struct Block {
+        std::atomic<std::size_t> references;
+        std::size_t size;
+        std::pmr::memory_resource *resource;
+
+        // Hash of the elements remembered by rememberHash(), 0 when unknown, reset when the elements are written
+        std::atomic<uint64_t> hash;
+    };
+
+    // Alignment of the elements, a cache line so that the rows start on a boundary the vector units like
+    static constexpr std::size_t ALIGNMENT = 64;
+    static constexpr std::size_t HEADER_SIZE = (sizeof(Block) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+    Block *block = nullptr;
+
+    /**
+     * @brief Allocates a new block of elements with a single reference.
+     * @param size The number of elements.
+     * @param resource The memory resource providing the memory.
+     * @return The new block, nullptr if the size is 0.
+     */
+    static Block *allocate(std::size_t size, std::pmr::memory_resource *resource);
+
+    /**
+     * @brief Gets the elements stored after a block.
+     * @param header The block.
+     * @return A pointer to the first element, nullptr if the block is nullptr.
+     */
+    static unsigned *elements(Block *header) {
+        return header ? reinterpret_cast<unsigned *>(reinterpret_cast<std::byte *>(header) + HEADER_SIZE) : nullptr;
+    }
+
+    /** @brief Drops the reference to the block, frees it if it was the last one. */
+    void release() noexcept;
+
+public:
+    // region Ctors and Destructor
+
+    /** @brief Constructs an empty buffer. */
+    SharedBuffer() noexcept = default;
+
+    /**
+     * @brief Constructs a buffer of uninitialized elements.
+     * @param size The number of elements.
+     * @param resource The memory resource providing the memory, the default resource if not given.
+     */
+    explicit SharedBuffer(std::size_t size, std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Copy constructor, shares the elements of the other buffer.
+     * @param other The buffer to share the elements with.
+     */
+    SharedBuffer(const SharedBuffer &other) noexcept;
+
+    /**
+     * @brief Move constructor.
+     * @param other The buffer to move from, leaving it empty.
+     */
+    SharedBuffer(SharedBuffer &&other) noexcept;
+
+    /** @brief Destructor that frees the elements if no other buffer references them. */
+    ~SharedBuffer();
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of elements of the buffer. */
+    [[nodiscard]] std::size_t size() const { return block ? block->size : 0; }
+
+    /** @return A read-only pointer to the elements, nullptr if the buffer is empty. */
+    [[nodiscard]] const unsigned *data() const { return elements(block); }
+
+    /** @return The memory resource providing the memory of the elements, nullptr if the buffer is empty. */
+    [[nodiscard]] std::pmr::memory_resource *resource() const { return block ? block->resource : nullptr; }
+
+    /**
+     * @brief Gives a writable access to the elements, duplicating them first if they are shared with another buffer.
+     * @return A pointer to the elements, nullptr if the buffer is empty.
+     */
+    [[nodiscard]] unsigned *mutableData();
+
+    /** @return The hash of the elements given to rememberHash(), 0 if none or mutableData() was called since. */
+    [[nodiscard]] uint64_t rememberedHash() const {
+        return block ? block->hash.load(std::memory_order_relaxed) : 0;
+    }
+
+    /**
+     * @brief Remembers the hash of the elements, for this buffer and all the buffers sharing them, until mutableData()
+     * is called.
+     * @param hash The hash of the elements, must not be 0.
+     */
+    void rememberHash(uint64_t hash) const {
+        if (block) {
+            block->hash.store(hash, std::memory_order_relaxed);
+        }
+    }
+
+    /** @return true if the elements are referenced by another buffer, false otherwise. */
+    [[nodiscard]] bool isShared() const;
+
+    /**
+     * @brief Creates a buffer holding a private copy of the elements, from the same memory resource.
+     * @return The new buffer.
+     */
+    [[nodiscard]] SharedBuffer clone() const;
+    // endregion
+
+    // region Operators
+
+    /**
+     * @brief Assignment operator, shares the elements of the other buffer.
+     * @param other The buffer to share the elements with, taken by value (copy-and-swap idiom).
+     * @return A reference to this buffer.
+     */
+    SharedBuffer &operator=(SharedBuffer other) noexcept;
+    // endregion
+};
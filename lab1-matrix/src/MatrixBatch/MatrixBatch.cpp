@@ -0,0 +1,194 @@
+#include "MatrixBatch.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include "../Utils/Modular.h"
+#include "../Utils/Parallel.h"
+
+// region Constructors
+
+MatrixBatch::MatrixBatch(std::size_t count, unsigned rows, unsigned columns, unsigned modulo) : count(count),
+                                                                                                rows(rows),
+                                                                                                columns(columns),
+                                                                                                modulo(modulo) {
+    if (modulo < 1) {
+        throw std::invalid_argument("modulo cannot be zero or less");
+    }
+
+    if (rows < 1) {
+        throw std::runtime_error("rows cannot be less than 1");
+    }
+
+    if (columns < 1) {
+        throw std::runtime_error("columns cannot be less than 1");
+    }
+
+    data.assign(std::size_t(rows) * columns * count, 0);
+}
+// endregion
+
+// region Public Methods
+
+void MatrixBatch::set(std::size_t index, const Matrix &matrix) {
+    if (index >= count) {
+        throw std::out_of_range("The index is outside the batch");
+    }
+
+    if (matrix.rows != rows || matrix.columns != columns || matrix.modulo != modulo) {
+        throw std::invalid_argument("The matrix must have the size and the modulo of the batch");
+    }
+
+    for (unsigned i = 0; i < rows; ++i) {
+        const unsigned *row = matrix.rowData(i);
+        for (unsigned j = 0; j < columns; ++j) {
+            data[(std::size_t(i) * columns + j) * count + index] = row[j];
+        }
+    }
+}
+
+Matrix MatrixBatch::get(std::size_t index) const {
+    if (index >= count) {
+        throw std::out_of_range("The index is outside the batch");
+    }
+
+    Matrix result = Matrix::zeros(rows, columns, modulo);
+    for (unsigned i = 0; i < rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (unsigned j = 0; j < columns; ++j) {
+            row[j] = data[(std::size_t(i) * columns + j) * count + index];
+        }
+    }
+    return result;
+}
+
+// region Add
+MatrixBatch &MatrixBatch::add(const MatrixBatch &other) {
+    const unsigned mod = modulo;
+    applyOperator(other, [mod](unsigned n, unsigned m) { return Modular::add(n, m, mod); });
+    return *this;
+}
+
+MatrixBatch MatrixBatch::addStatic(const MatrixBatch &other) const {
+    MatrixBatch result(*this);
+    result.add(other);
+    return result;
+}
+// endregion
+
+// region Sub
+MatrixBatch &MatrixBatch::sub(const MatrixBatch &other) {
+    const unsigned mod = modulo;
+    applyOperator(other, [mod](unsigned n, unsigned m) { return Modular::sub(n, m, mod); });
+    return *this;
+}
+
+MatrixBatch MatrixBatch::subStatic(const MatrixBatch &other) const {
+    MatrixBatch result(*this);
+    result.sub(other);
+    return result;
+}
+// endregion
+
+// region Multiply
+MatrixBatch &MatrixBatch::multiply(const MatrixBatch &other) {
+    const unsigned mod = modulo;
+    applyOperator(other, [mod](unsigned n, unsigned m) { return Modular::multiply(n, m, mod); });
+    return *this;
+}
+
+MatrixBatch MatrixBatch::multiplyStatic(const MatrixBatch &other) const {
+    MatrixBatch result(*this);
+    result.multiply(other);
+    return result;
+}
+// endregion
+
+MatrixBatch MatrixBatch::product(const MatrixBatch &other) const {
+    checkCompatible(other);
+    if (columns != other.rows) {
+        throw std::invalid_argument("The number of columns of the left matrices must be the number of rows of the right ones");
+    }
+
+    MatrixBatch result(count, rows, other.columns, modulo);
+    const uint64_t interval = Modular::reductionInterval(modulo);
+    const unsigned inner = columns, resultColumns = other.columns;
+
+    Parallel::forRange(0, count, PARALLEL_GRAIN, [&](std::size_t first, std::size_t last) {
+        const std::size_t lanes = last - first;
+        std::vector<uint64_t> accumulator(lanes);
+
+        for (unsigned i = 0; i < rows; ++i) {
+            for (unsigned j = 0; j < resultColumns; ++j) {
+                std::fill(accumulator.begin(), accumulator.end(), 0);
+                uint64_t pending = 0;
+
+                for (unsigned k = 0; k < inner; ++k) {
+                    const unsigned *lhs = data.data() + (std::size_t(i) * inner + k) * count + first;
+                    const unsigned *rhs = other.data.data() + (std::size_t(k) * resultColumns + j) * count + first;
+                    for (std::size_t b = 0; b < lanes; ++b) {
+                        accumulator[b] += uint64_t(lhs[b]) * rhs[b];
+                    }
+                    if (++pending == interval) {
+                        for (uint64_t &sum: accumulator) {
+                            sum %= modulo;
+                        }
+                        pending = 0;
+                    }
+                }
+
+                unsigned *out = result.data.data() + (std::size_t(i) * resultColumns + j) * count + first;
+                for (std::size_t b = 0; b < lanes; ++b) {
+                    out[b] = unsigned(accumulator[b] % modulo);
+                }
+            }
+        }
+    });
+    return result;
+}
+// endregion
+
+// region Operators
+
+MatrixBatch operator+(const MatrixBatch &lhs, const MatrixBatch &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+MatrixBatch operator-(const MatrixBatch &lhs, const MatrixBatch &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+MatrixBatch operator*(const MatrixBatch &lhs, const MatrixBatch &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+// endregion
+
+// region Private Methods
+
+void MatrixBatch::checkCompatible(const MatrixBatch &other) const {
+    if (other.modulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 batches must be identical");
+    }
+
+    if (other.count != count) {
+        throw std::invalid_argument("The 2 batches must hold the same number of matrices");
+    }
+}
+
+template<typename LaneOperation>
+void MatrixBatch::applyOperator(const MatrixBatch &other, LaneOperation op) {
+    checkCompatible(other);
+    if (other.rows != rows || other.columns != columns) {
+        throw std::invalid_argument("The matrices of the 2 batches must have the same size");
+    }
+
+    const std::size_t elements = std::size_t(rows) * columns;
+    Parallel::forRange(0, count, PARALLEL_GRAIN, [&](std::size_t first, std::size_t last) {
+        for (std::size_t e = 0; e < elements; ++e) {
+            unsigned *lhs = data.data() + e * count;
+            const unsigned *rhs = other.data.data() + e * count;
+            for (std::size_t b = first; b < last; ++b) {
+                lhs[b] = op(lhs[b], rhs[b]);
+            }
+        }
+    });
+}
+// endregion
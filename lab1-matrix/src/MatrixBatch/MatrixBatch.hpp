@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class MatrixBatch
+ * @brief Represents a batch of independent matrices of the same size, with elements stored modulo n.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The matrices are stored in a single interleaved buffer: the element (i, j) of all the matrices are contiguous.
+ * An operation therefore processes the same element of consecutive matrices in the innermost loop, which the
+ * compiler maps to SIMD lanes, and the batch is split in ranges of matrices across threads.
+ * It avoids creating a Matrix (and its heap allocated rows) for each of many small operations.
+ */
+class MatrixBatch {
+private:
+    // region Fields
+
+    // Minimum number of matrices given to a thread
+    static constexpr std::size_t PARALLEL_GRAIN = 1024;
+
+    std::size_t count;
+    unsigned rows, columns, modulo;
+
+    // The element (i, j) of the matrix b is stored at (i * columns + j) * count + b
+    std::vector<unsigned> data;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Checks that another batch has the same number of matrices and the same modulo as this batch.
+     * @param other The other batch.
+     * @throws std::invalid_argument if the batches are not compatible.
+     */
+    void checkCompatible(const MatrixBatch &other) const;
+
+    /**
+     * @brief Applies an operation to each element of each matrix of this batch with the same element of another batch.
+     * @param other The other batch to operate with, it must have the same size.
+     * @param op The modular operation to apply on two elements.
+     * @throws std::invalid_argument if the batches do not have the same size.
+     */
+    template<typename LaneOperation>
+    void applyOperator(const MatrixBatch &other, LaneOperation op);
+
+    // endregion
+
+public:
+    // region Ctors
+    MatrixBatch() = delete;
+
+    /**
+    * @brief Constructs a batch of matrices whose elements are all 0.
+    * @param count The number of matrices in the batch.
+    * @param rows Number of rows of each matrix.
+    * @param columns Number of columns of each matrix.
+    * @param modulo The modulo value for matrix operations.
+    */
+    MatrixBatch(std::size_t count, unsigned rows, unsigned columns, unsigned modulo);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of matrices in the batch. */
+    [[nodiscard]] std::size_t size() const { return count; }
+
+    /** @return The number of rows of each matrix. */
+    [[nodiscard]] unsigned getRows() const { return rows; }
+
+    /** @return The number of columns of each matrix. */
+    [[nodiscard]] unsigned getColumns() const { return columns; }
+
+    /** @return The modulo applied to the elements of the matrices. */
+    [[nodiscard]] unsigned getModulo() const { return modulo; }
+
+    /**
+     * @brief Copies a matrix into the batch.
+     * @param index The index of the matrix in the batch.
+     * @param matrix The matrix to copy, it must have the size and the modulo of the batch.
+     * @throws std::out_of_range if the index is outside the batch.
+     * @throws std::invalid_argument if the matrix does not have the size or the modulo of the batch.
+     */
+    void set(std::size_t index, const Matrix &matrix);
+
+    /**
+     * @brief Copies a matrix out of the batch.
+     * @param index The index of the matrix in the batch.
+     * @return A new Matrix instance holding the elements of the matrix.
+     * @throws std::out_of_range if the index is outside the batch.
+     */
+    [[nodiscard]] Matrix get(std::size_t index) const;
+
+    /**
+     * @brief Adds each matrix of another batch to the matrix with the same index in this batch, in-place.
+     * @param other The batch to be added to this batch.
+     * @return A reference to this batch after the addition.
+     */
+    MatrixBatch &add(const MatrixBatch &other);
+
+    /**
+     * @brief Creates a new batch that is the result of adding another batch to this batch.
+     * @param other The batch to be added to this batch.
+     * @return A new MatrixBatch instance that is the result of the addition.
+     */
+    [[nodiscard]] MatrixBatch addStatic(const MatrixBatch &other) const;
+
+    /**
+     * @brief Subtracts each matrix of another batch to the matrix with the same index in this batch, in-place.
+     * @param other The batch to be subtracted to this batch.
+     * @return A reference to this batch after the subtraction.
+     */
+    MatrixBatch &sub(const MatrixBatch &other);
+
+    /**
+     * @brief Creates a new batch that is the result of subtracting another batch to this batch.
+     * @param other The batch to be subtracted to this batch.
+     * @return A new MatrixBatch instance that is the result of the subtraction.
+     */
+    [[nodiscard]] MatrixBatch subStatic(const MatrixBatch &other) const;
+
+    /**
+     * @brief Multiplies (component by component) each matrix of another batch to the matrix with the same index in
+     * this batch, in-place.
+     * @param other The batch to be multiplied to this batch.
+     * @return A reference to this batch after the multiplication.
+     */
+    MatrixBatch &multiply(const MatrixBatch &other);
+
+    /**
+     * @brief Creates a new batch that is the result of multiplying (component by component) another batch to this batch.
+     * @param other The batch to be multiplied to this batch.
+     * @return A new MatrixBatch instance that is the result of the multiplication.
+     */
+    [[nodiscard]] MatrixBatch multiplyStatic(const MatrixBatch &other) const;
+
+    /**
+     * @brief Computes the matrix product of each matrix of this batch with the matrix with the same index in another batch.
+     * @param other The right-hand side batch, the number of rows of its matrices must be the number of columns of
+     * the matrices of this batch.
+     * @return A new MatrixBatch instance holding the products.
+     * @throws std::invalid_argument if the batches are not compatible or the inner dimensions are different.
+     */
+    [[nodiscard]] MatrixBatch product(const MatrixBatch &other) const;
+
+    // endregion
+};
+
+/**
+ * @brief Adds two batches of matrices.
+ * @param lhs The left-hand side batch.
+ * @param rhs The right-hand side batch.
+ * @return A new batch that is the result of adding the two batches.
+ */
+MatrixBatch operator+(const MatrixBatch &lhs, const MatrixBatch &rhs);
+
+/**
+ * @brief Subtracts two batches of matrices.
+ * @param lhs The left-hand side batch.
+ * @param rhs The right-hand side batch.
+ * @return A new batch that is the result of subtracting the two batches.
+ */
+MatrixBatch operator-(const MatrixBatch &lhs, const MatrixBatch &rhs);
+
+/**
+ * @brief Multiplies two batches of matrices component by component.
+ * @param lhs The left-hand side batch.
+ * @param rhs The right-hand side batch.
+ * @return A new batch that is the result of multiplying the two batches.
+ */
+MatrixBatch operator*(const MatrixBatch &lhs, const MatrixBatch &rhs);
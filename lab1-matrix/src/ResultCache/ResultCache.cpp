@@ -0,0 +1,104 @@
+#include "ResultCache.hpp"
+#include <iterator>
+#include <stdexcept>
+
+// region Constructors
+
+ResultCache::ResultCache(std::size_t capacity) : capacity(capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("The capacity of the cache cannot be zero");
+    }
+}
+// endregion
+
+// region Public Methods
+
+Matrix ResultCache::apply(Operation operation, const Matrix &lhs, const Matrix &rhs) {
+    // The hashes include the dimensions and the modulo of the operands
+    const uint64_t key = (lhs.hash() * 31 + rhs.hash()) * 31 + uint64_t(operation) + (uint64_t(lhs.getModulo()) << 8);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto entry = find(operation, key, lhs, rhs);
+        if (entry != entries.end()) {
+            entries.splice(entries.begin(), entries, entry);
+            ++hits;
+            return entry->result;
+        }
+        ++misses;
+    }
+
+    // The operation is computed without holding the mutex, the other threads can use the cache meanwhile
+    Matrix result = compute(operation, lhs, rhs);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (find(operation, key, lhs, rhs) == entries.end()) {
+        entries.push_front({operation, key, lhs, rhs, result});
+        index.emplace(key, entries.begin());
+
+        if (entries.size() > capacity) {
+            auto last = std::prev(entries.end());
+            auto range = index.equal_range(last->key);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == last) {
+                    index.erase(it);
+                    break;
+                }
+            }
+            entries.pop_back();
+        }
+    }
+    return result;
+}
+
+std::size_t ResultCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+std::size_t ResultCache::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+std::size_t ResultCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+void ResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    entries.clear();
+}
+// endregion
+
+// region Private Methods
+
+std::list<ResultCache::Entry>::iterator ResultCache::find(Operation operation, uint64_t key, const Matrix &lhs,
+                                                          const Matrix &rhs) {
+    // Equal keys are confirmed by comparing the operands, which share their buffers when they are unchanged
+    auto range = index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry &entry = *it->second;
+        if (entry.operation == operation && entry.lhs == lhs && entry.rhs == rhs) {
+            return it->second;
+        }
+    }
+    return entries.end();
+}
+
+Matrix ResultCache::compute(Operation operation, const Matrix &lhs, const Matrix &rhs) {
+    switch (operation) {
+        case Operation::Add:
+            return lhs + rhs;
+        case Operation::Sub:
+            return lhs - rhs;
+        case Operation::Multiply:
+            return lhs * rhs;
+        case Operation::Product:
+            return lhs.product(rhs);
+    }
+    throw std::invalid_argument("Unknown operation");
+}
+// endregion
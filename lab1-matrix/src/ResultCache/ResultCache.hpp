@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class ResultCache
+ * @brief Bounded cache of the results of the operations between matrices, the least recently used result is evicted
+ * first.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The results are found by the operation, the hashes of the operands (see Matrix::hash) and the modulo. The hashes of
+ * unchanged matrices are remembered by their buffers, so looking a result up does not read the operands again. A
+ * cached result is only returned when the operands are equal to the ones it was computed from: the cache keeps copies
+ * of them, which share the buffers of the operands (copy-on-write), so the comparison usually reads no element and a
+ * hash collision cannot return a wrong result. A cache can be used from several threads.
+ */
+class ResultCache {
+public:
+    /** @brief The operations whose results are cached. */
+    enum class Operation {
+        Add,      // Matrix addition, as operator+
+        Sub,      // Matrix subtraction, as operator-
+        Multiply, // Component by component multiplication, as operator*
+        Product   // Matrix product, as Matrix::product
+    };
+
+private:
+    /** @brief A cached result with the operands it was computed from. */
+    struct Entry {
+        Operation operation;
+        uint64_t key;
+        Matrix lhs, rhs, result;
+    };
+
+    std::size_t capacity;
+    std::size_t hits = 0, misses = 0;
+
+    // The entries from the most to the least recently used, and the entries by key
+    std::list<Entry> entries;
+    std::unordered_multimap<uint64_t, std::list<Entry>::iterator> index;
+    mutable std::mutex mutex;
+
+    /**
+     * @brief Finds the entry of an operation, the caller holds the mutex.
+     * @return The entry, entries.end() if the result is not cached.
+     */
+    std::list<Entry>::iterator find(Operation operation, uint64_t key, const Matrix &lhs, const Matrix &rhs);
+
+    /**
+     * @brief Computes the result of an operation.
+     * @return The result of the operation.
+     */
+    static Matrix compute(Operation operation, const Matrix &lhs, const Matrix &rhs);
+
+public:
+    // region Ctors
+    ResultCache() = delete;
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity The maximum number of results kept.
+     * @throws std::invalid_argument if the capacity is 0.
+     */
+    explicit ResultCache(std::size_t capacity);
+    // endregion
+
+    // region Public methods
+
+    /**
+     * @brief Gets the result of an operation from the cache, or computes it and caches it.
+     * @param operation The operation.
+     * @param lhs The left-hand side matrix.
+     * @param rhs The right-hand side matrix.
+     * @return The result of the operation, it shares the buffer of the cached result.
+     * @throws Any exception thrown by the operation, nothing is cached then.
+     */
+    Matrix apply(Operation operation, const Matrix &lhs, const Matrix &rhs);
+
+    /** @return The maximum number of results kept. */
+    [[nodiscard]] std::size_t getCapacity() const { return capacity; }
+
+    /** @return The number of results currently kept. */
+    [[nodiscard]] std::size_t size() const;
+
+    /** @return The number of operations whose result was found in the cache. */
+    [[nodiscard]] std::size_t getHits() const;
+
+    /** @return The number of operations that were computed. */
+    [[nodiscard]] std::size_t getMisses() const;
+
+    /** @brief Drops all the results, the counters are kept. */
+    void clear();
+
+    // endregion
+};
@@ -0,0 +1,203 @@
+#include "RnsMatrix.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include "../Utils/Modular.h"
+#include "../Utils/Parallel.h"
+#include "../Utils/Tuning.h"
+
+// region Constructors
+
+RnsMatrix::RnsMatrix(unsigned rows, unsigned columns, const std::vector<unsigned> &primes) {
+    for (unsigned prime: primes) {
+        channels.emplace_back(rows, columns, prime);
+    }
+    prepareChannels();
+}
+
+RnsMatrix::RnsMatrix(const Matrix &matrix, const std::vector<unsigned> &primes) {
+    matrix.checkData();
+
+    for (unsigned prime: primes) {
+        Matrix channel = Matrix::zeros(matrix.rows, matrix.columns, prime);
+        unsigned *elements = channel.data.mutableData();
+        const unsigned *values = matrix.data.data();
+        for (std::size_t i = 0; i < matrix.data.size(); ++i) {
+            elements[i] = values[i] % prime;
+        }
+        channels.push_back(std::move(channel));
+    }
+    prepareChannels();
+}
+
+RnsMatrix::RnsMatrix(std::vector<Matrix> channels) : channels(std::move(channels)) {
+    prepareChannels();
+}
+// endregion
+
+// region Public methods
+
+BigUnsigned RnsMatrix::getModulus() const {
+    BigUnsigned modulus(1);
+    for (const Matrix &channel: channels) {
+        modulus.multiplyAdd(channel.getModulo(), 0);
+    }
+    return modulus;
+}
+
+BigUnsigned RnsMatrix::get(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= getRows() || columnIndex >= getColumns()) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    return reconstruct(rowIndex, columnIndex);
+}
+
+// The channels use the fused kernels of Matrix, which reduce in 64 bits and stay exact for word-size primes
+
+RnsMatrix &RnsMatrix::add(const RnsMatrix &other) {
+    applyChannels(other, [](Matrix &channel, const Matrix &otherChannel) { channel.axpy(1, otherChannel); });
+    return *this;
+}
+
+RnsMatrix RnsMatrix::addStatic(const RnsMatrix &other) const {
+    RnsMatrix result(*this);
+    result.add(other);
+    return result;
+}
+
+RnsMatrix &RnsMatrix::sub(const RnsMatrix &other) {
+    applyChannels(other, [](Matrix &channel, const Matrix &otherChannel) {
+        channel.axpy(channel.getModulo() - 1, otherChannel);
+    });
+    return *this;
+}
+
+RnsMatrix RnsMatrix::subStatic(const RnsMatrix &other) const {
+    RnsMatrix result(*this);
+    result.sub(other);
+    return result;
+}
+
+RnsMatrix &RnsMatrix::multiply(const RnsMatrix &other) {
+    applyChannels(other, [](Matrix &channel, const Matrix &otherChannel) {
+        channel.multiply(otherChannel);
+    });
+    return *this;
+}
+
+RnsMatrix RnsMatrix::multiplyStatic(const RnsMatrix &other) const {
+    RnsMatrix result(*this);
+    result.multiply(other);
+    return result;
+}
+
+RnsMatrix RnsMatrix::product(const RnsMatrix &other) const {
+    RnsMatrix result(*this);
+    result.applyChannels(other, [](Matrix &channel, const Matrix &otherChannel) {
+        channel = channel.product(otherChannel);
+    });
+    return result;
+}
+// endregion
+
+// region Operators
+
+std::ostream &operator<<(std::ostream &os, const RnsMatrix &matrix) {
+    for (unsigned i = 0; i < matrix.getRows(); ++i) {
+        for (unsigned j = 0; j < matrix.getColumns(); ++j) {
+            os << matrix.reconstruct(i, j) << " ";
+        }
+        os << std::endl;
+    }
+    return os;
+}
+
+RnsMatrix operator+(const RnsMatrix &lhs, const RnsMatrix &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+RnsMatrix operator-(const RnsMatrix &lhs, const RnsMatrix &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+RnsMatrix operator*(const RnsMatrix &lhs, const RnsMatrix &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+// endregion
+
+// region Private Methods
+
+void RnsMatrix::prepareChannels() {
+    if (channels.empty()) {
+        throw std::invalid_argument("The modulus must have at least one prime");
+    }
+
+    const std::size_t count = channels.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        channels[i].checkData();
+        const unsigned prime = channels[i].getModulo();
+        if (!Modular::isPrime(prime)) {
+            throw std::invalid_argument("The moduli of the channels must be prime");
+        }
+        if (channels[i].getRows() != getRows() || channels[i].getColumns() != getColumns()) {
+            throw std::invalid_argument("The channels must have the same dimensions");
+        }
+        for (std::size_t j = 0; j < i; ++j) {
+            if (channels[j].getModulo() == prime) {
+                throw std::invalid_argument("The moduli of the channels must be distinct");
+            }
+        }
+    }
+
+    // The inverses used by Garner's algorithm only depend on the primes, they are computed once
+    inverses.assign(count * count, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = i + 1; j < count; ++j) {
+            const unsigned prime = channels[j].getModulo();
+            inverses[i * count + j] = Modular::inverse(channels[i].getModulo() % prime, prime);
+        }
+    }
+}
+
+template<typename ChannelOperation>
+void RnsMatrix::applyChannels(const RnsMatrix &other, ChannelOperation op) {
+    if (other.channels.size() != channels.size()) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+    for (std::size_t i = 0; i < channels.size(); ++i) {
+        if (other.channels[i].getModulo() != channels[i].getModulo()) {
+            throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+        }
+    }
+
+    // Small channels are processed in parallel, large ones (from the element grain of Tuning) one after the other, each
+    // split across the threads
+    const std::size_t elements = std::size_t(std::max(getRows(), other.getRows())) *
+                                 std::max(getColumns(), other.getColumns());
+    const std::size_t channelGrain = elements < Tuning::elementGrain() ? 1 : channels.size();
+    Parallel::forRange(0, channels.size(), channelGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            op(channels[i], other.channels[i]);
+        }
+    });
+}
+
+BigUnsigned RnsMatrix::reconstruct(unsigned rowIndex, unsigned columnIndex) const {
+    // Mixed radix digits: value = d0 + d1 * p0 + d2 * p0 * p1 + ...
+    const std::size_t count = channels.size();
+    std::vector<unsigned> digits(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const unsigned prime = channels[i].getModulo();
+        unsigned digit = channels[i].rowData(rowIndex)[columnIndex];
+        for (std::size_t j = 0; j < i; ++j) {
+            digit = Modular::multiply(Modular::sub(digit, digits[j] % prime, prime), inverses[j * count + i], prime);
+        }
+        digits[i] = digit;
+    }
+
+    BigUnsigned value(digits[count - 1]);
+    for (std::size_t i = count - 1; i-- > 0;) {
+        value.multiplyAdd(channels[i].getModulo(), digits[i]);
+    }
+    return value;
+}
+// endregion
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+#include "../Utils/BigUnsigned.h"
+
+/**
+ * @class RnsMatrix
+ * @brief Represents a matrix with elements stored modulo a product of word-size primes, beyond 64 bits, in a residue
+ * number system.
+ * @authors Slimani Walid, Van Hove Timothée
+ * By the Chinese remainder theorem, a value modulo M = p1 * ... * pk is given by its residues modulo each prime. The
+ * matrix is kept as one Matrix per prime (a channel): every operation, including the matrix product, is done
+ * independently in each channel with the kernels of Matrix, and the channels are processed in parallel. The values
+ * modulo M are only reconstructed, with Garner's algorithm, when an element is read or the matrix is printed.
+ * The semantics are the same as Matrix: an operand smaller than the other one is considered padded with zeros.
+ */
+class RnsMatrix {
+private:
+    // region Fields
+
+    // One matrix per prime of the modulus, with the same dimensions
+    std::vector<Matrix> channels;
+
+    // inverses[i * k + j] is the inverse of the prime i modulo the prime j, for i < j
+    std::vector<unsigned> inverses;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Checks the primes of a modulus and precomputes the constants of Garner's algorithm.
+     * @throws std::invalid_argument if there is no channel or the moduli of the channels are not distinct primes.
+     */
+    void prepareChannels();
+
+    /**
+     * @brief Applies an operation to each channel of this matrix with the same channel of another matrix.
+     * @param other The other matrix.
+     * @param op The operation applied to two matrices of a channel.
+     * @throws std::invalid_argument if the moduli of the matrices are different.
+     */
+    template<typename ChannelOperation>
+    void applyChannels(const RnsMatrix &other, ChannelOperation op);
+
+    /**
+     * @brief Reconstructs the value of an element from its residues with Garner's algorithm.
+     * @param rowIndex The row index, must be lower than the number of rows.
+     * @param columnIndex The column index, must be lower than the number of columns.
+     * @return The value modulo the product of the primes.
+     */
+    [[nodiscard]] BigUnsigned reconstruct(unsigned rowIndex, unsigned columnIndex) const;
+
+    // endregion
+
+public:
+    // region Ctors
+    RnsMatrix() = delete;
+
+    /**
+    * @brief Constructs a RnsMatrix with random elements modulo the product of the primes.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param primes The distinct primes whose product is the modulus.
+    * @throws std::invalid_argument if there is no prime, or a prime is not prime or repeated.
+    */
+    RnsMatrix(unsigned rows, unsigned columns, const std::vector<unsigned> &primes);
+
+    /**
+    * @brief Constructs a RnsMatrix holding the elements of a matrix, taken as integers.
+    * @param matrix The matrix, its modulo is ignored.
+    * @param primes The distinct primes whose product is the modulus.
+    * @throws std::invalid_argument if there is no prime, or a prime is not prime or repeated.
+    */
+    RnsMatrix(const Matrix &matrix, const std::vector<unsigned> &primes);
+
+    /**
+    * @brief Constructs a RnsMatrix from its residues.
+    * @param channels The matrix of the residues modulo each prime, with the same dimensions.
+    * @throws std::invalid_argument if there is no channel, the moduli are not distinct primes or the dimensions of
+    * the channels are different.
+    */
+    explicit RnsMatrix(std::vector<Matrix> channels);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of rows of the matrix. */
+    [[nodiscard]] unsigned getRows() const { return channels.front().getRows(); }
+
+    /** @return The number of columns of the matrix. */
+    [[nodiscard]] unsigned getColumns() const { return channels.front().getColumns(); }
+
+    /** @return The number of primes of the modulus. */
+    [[nodiscard]] std::size_t getChannelCount() const { return channels.size(); }
+
+    /**
+     * @brief Gives the residues of the elements modulo a prime of the modulus.
+     * @param index The index of the prime.
+     * @return The matrix of the residues.
+     * @throws std::out_of_range if there is no such channel.
+     */
+    [[nodiscard]] const Matrix &getChannel(std::size_t index) const { return channels.at(index); }
+
+    /** @return The modulus, the product of the primes. */
+    [[nodiscard]] BigUnsigned getModulus() const;
+
+    /**
+     * @brief Gets the value of an element, reconstructed from its residues.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element modulo the product of the primes.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    [[nodiscard]] BigUnsigned get(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Adds another matrix to this matrix in-place.
+     * @param other The matrix to be added to this matrix.
+     * @return A reference to this matrix after the addition.
+     */
+    RnsMatrix &add(const RnsMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the result of adding another matrix to this matrix.
+     * @param other The matrix to be added to this matrix.
+     * @return A new RnsMatrix instance that is the result of the addition.
+     */
+    [[nodiscard]] RnsMatrix addStatic(const RnsMatrix &other) const;
+
+    /**
+     * @brief Subtracts another matrix to this matrix in-place.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A reference to this matrix after the subtraction.
+     */
+    RnsMatrix &sub(const RnsMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the result of subtracting another matrix to this matrix.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A new RnsMatrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] RnsMatrix subStatic(const RnsMatrix &other) const;
+
+    /**
+     * @brief Multiplies (component by component) another matrix to this matrix in-place.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A reference to this matrix after the multiplication.
+     */
+    RnsMatrix &multiply(const RnsMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the component by component product of this matrix and another one.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A new RnsMatrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] RnsMatrix multiplyStatic(const RnsMatrix &other) const;
+
+    /**
+     * @brief Computes the matrix product of this matrix with another one, channel by channel.
+     * @param other The right-hand side matrix, its number of rows must be the number of columns of this matrix.
+     * @return A new RnsMatrix instance that is the result of the product.
+     * @throws std::invalid_argument if the moduli or the inner dimensions are different.
+     */
+    [[nodiscard]] RnsMatrix product(const RnsMatrix &other) const;
+
+    // endregion
+
+    // region Operators
+
+    /**
+    * @brief Stream insertion operator for RnsMatrix class, prints the reconstructed elements in base 10.
+    * @param os The output stream to insert into.
+    * @param matrix The RnsMatrix object to insert into the stream.
+    * @return A reference to the modified output stream.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const RnsMatrix &matrix);
+    // endregion
+};
+
+/**
+ * @brief Adds two residue matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of adding the two matrices.
+ */
+RnsMatrix operator+(const RnsMatrix &lhs, const RnsMatrix &rhs);
+
+/**
+ * @brief Subtracts two residue matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of subtracting the two matrices.
+ */
+RnsMatrix operator-(const RnsMatrix &lhs, const RnsMatrix &rhs);
+
+/**
+ * @brief Multiplies two residue matrices component by component.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of multiplying the two matrices.
+ */
+RnsMatrix operator*(const RnsMatrix &lhs, const RnsMatrix &rhs);
@@ -0,0 +1,392 @@
+#include "SparseMatrix.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "../Utils/Modular.h"
+
+// region Constructors
+
+SparseMatrix::SparseMatrix(unsigned rows, unsigned columns, unsigned modulo) : rows(rows), columns(columns),
+                                                                               modulo(modulo) {
+    checkArguments(rows, columns, modulo);
+    rowPointers.assign(std::size_t(rows) + 1, 0);
+}
+
+SparseMatrix::SparseMatrix(unsigned rows, unsigned columns, unsigned modulo, std::vector<Entry> entries)
+        : SparseMatrix(rows, columns, modulo) {
+    for (const Entry &entry: entries) {
+        if (entry.row >= rows || entry.column >= columns) {
+            throw std::out_of_range("The element is outside the matrix");
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry &lhs, const Entry &rhs) {
+        return lhs.row != rhs.row ? lhs.row < rhs.row : lhs.column < rhs.column;
+    });
+
+    columnIndices.reserve(entries.size());
+    values.reserve(entries.size());
+
+    std::size_t i = 0;
+    while (i < entries.size()) {
+        // Sum the duplicated coordinates before storing the element
+        const Entry &entry = entries[i];
+        unsigned value = entry.value % modulo;
+        for (++i; i < entries.size() && entries[i].row == entry.row && entries[i].column == entry.column; ++i) {
+            value = Modular::add(value, entries[i].value % modulo, modulo);
+        }
+
+        if (value != 0) {
+            columnIndices.push_back(entry.column);
+            values.push_back(value);
+            ++rowPointers[std::size_t(entry.row) + 1];
+        }
+    }
+
+    // Turn the number of elements per row into offsets
+    for (unsigned r = 0; r < rows; ++r) {
+        rowPointers[r + 1] += rowPointers[r];
+    }
+}
+
+SparseMatrix::SparseMatrix(const Matrix &dense) : SparseMatrix(dense.rows, dense.columns, dense.modulo) {
+    for (unsigned i = 0; i < rows; ++i) {
+        const unsigned *row = dense.rowData(i);
+        for (unsigned j = 0; j < columns; ++j) {
+            if (row[j] != 0) {
+                columnIndices.push_back(j);
+                values.push_back(row[j]);
+            }
+        }
+        rowPointers[i + 1] = values.size();
+    }
+}
+// endregion
+
+// region Public Methods
+
+unsigned SparseMatrix::get(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+
+    auto first = columnIndices.begin() + std::ptrdiff_t(rowPointers[rowIndex]);
+    auto last = columnIndices.begin() + std::ptrdiff_t(rowPointers[rowIndex + 1]);
+    auto it = std::lower_bound(first, last, columnIndex);
+    if (it == last || *it != columnIndex) {
+        return 0;
+    }
+    return values[std::size_t(it - columnIndices.begin())];
+}
+
+Matrix SparseMatrix::toDense() const {
+    Matrix result = Matrix::zeros(rows, columns, modulo);
+    for (unsigned i = 0; i < rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (std::size_t k = rowPointers[i]; k < rowPointers[i + 1]; ++k) {
+            row[columnIndices[k]] = values[k];
+        }
+    }
+    return result;
+}
+
+SparseMatrix SparseMatrix::transpose() const {
+    SparseMatrix result(columns, rows, modulo);
+    result.columnIndices.resize(values.size());
+    result.values.resize(values.size());
+
+    // Count the elements of each column, then turn the counts into offsets
+    for (unsigned column: columnIndices) {
+        ++result.rowPointers[std::size_t(column) + 1];
+    }
+    for (unsigned c = 0; c < columns; ++c) {
+        result.rowPointers[c + 1] += result.rowPointers[c];
+    }
+
+    // Scatter the elements, visiting the rows in order keeps the new rows sorted
+    std::vector<std::size_t> next(result.rowPointers.begin(), result.rowPointers.end() - 1);
+    for (unsigned i = 0; i < rows; ++i) {
+        for (std::size_t k = rowPointers[i]; k < rowPointers[i + 1]; ++k) {
+            std::size_t position = next[columnIndices[k]]++;
+            result.columnIndices[position] = i;
+            result.values[position] = values[k];
+        }
+    }
+    return result;
+}
+
+// region Add
+SparseMatrix &SparseMatrix::add(const SparseMatrix &other) {
+    *this = addStatic(other);
+    return *this;
+}
+
+SparseMatrix SparseMatrix::addStatic(const SparseMatrix &other) const {
+    unsigned mod = modulo;
+    return merge(other, true, [mod](unsigned n, unsigned m) { return Modular::add(n, m, mod); });
+}
+
+Matrix SparseMatrix::addStatic(const Matrix &other) const {
+    checkModulo(other.modulo);
+    Matrix result = paddedCopy(other);
+
+    // Only the non-zero elements change the dense copy
+    for (unsigned i = 0; i < rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (std::size_t k = rowPointers[i]; k < rowPointers[i + 1]; ++k) {
+            row[columnIndices[k]] = Modular::add(row[columnIndices[k]], values[k], modulo);
+        }
+    }
+    return result;
+}
+// endregion
+
+// region Sub
+SparseMatrix &SparseMatrix::sub(const SparseMatrix &other) {
+    *this = subStatic(other);
+    return *this;
+}
+
+SparseMatrix SparseMatrix::subStatic(const SparseMatrix &other) const {
+    unsigned mod = modulo;
+    return merge(other, true, [mod](unsigned n, unsigned m) { return Modular::sub(n, m, mod); });
+}
+
+Matrix SparseMatrix::subStatic(const Matrix &other) const {
+    checkModulo(other.modulo);
+    Matrix result = paddedCopy(other);
+
+    // Negate the dense operand, then add the non-zero elements
+    for (unsigned i = 0; i < result.rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (unsigned j = 0; j < result.columns; ++j) {
+            row[j] = Modular::sub(0, row[j], modulo);
+        }
+        if (i < rows) {
+            for (std::size_t k = rowPointers[i]; k < rowPointers[i + 1]; ++k) {
+                row[columnIndices[k]] = Modular::add(row[columnIndices[k]], values[k], modulo);
+            }
+        }
+    }
+    return result;
+}
+// endregion
+
+// region Multiply
+SparseMatrix &SparseMatrix::multiply(const SparseMatrix &other) {
+    *this = multiplyStatic(other);
+    return *this;
+}
+
+SparseMatrix SparseMatrix::multiplyStatic(const SparseMatrix &other) const {
+    unsigned mod = modulo;
+    return merge(other, false, [mod](unsigned n, unsigned m) { return Modular::multiply(n, m, mod); });
+}
+
+SparseMatrix SparseMatrix::multiplyStatic(const Matrix &other) const {
+    checkModulo(other.modulo);
+    SparseMatrix result(std::max(rows, other.rows), std::max(columns, other.columns), modulo);
+    result.columnIndices.reserve(values.size());
+    result.values.reserve(values.size());
+
+    for (unsigned i = 0; i < result.rows; ++i) {
+        // Elements outside of the dense matrix are multiplied by 0
+        if (i < rows && i < other.rows) {
+            const unsigned *denseRow = other.rowData(i);
+            for (std::size_t k = rowPointers[i]; k < rowPointers[i + 1] && columnIndices[k] < other.columns; ++k) {
+                unsigned value = Modular::multiply(values[k], denseRow[columnIndices[k]], modulo);
+                if (value != 0) {
+                    result.columnIndices.push_back(columnIndices[k]);
+                    result.values.push_back(value);
+                }
+            }
+        }
+        result.rowPointers[i + 1] = result.values.size();
+    }
+    return result;
+}
+// endregion
+
+Matrix SparseMatrix::product(const Matrix &other) const {
+    checkModulo(other.modulo);
+    if (columns != other.rows) {
+        throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+    }
+
+    Matrix result = Matrix::zeros(rows, other.columns, modulo);
+    const uint64_t interval = Modular::reductionInterval(modulo);
+    std::vector<uint64_t> accumulator(other.columns);
+
+    for (unsigned i = 0; i < rows; ++i) {
+        std::fill(accumulator.begin(), accumulator.end(), 0);
+        uint64_t pending = 0;
+
+        // Each non-zero element scales a whole row of the dense matrix, the reduction is delayed as long as possible
+        for (std::size_t k = rowPointers[i]; k < rowPointers[i + 1]; ++k) {
+            const uint64_t value = values[k];
+            const unsigned *denseRow = other.rowData(columnIndices[k]);
+            for (unsigned j = 0; j < other.columns; ++j) {
+                accumulator[j] += value * denseRow[j];
+            }
+            if (++pending == interval) {
+                for (uint64_t &sum: accumulator) {
+                    sum %= modulo;
+                }
+                pending = 0;
+            }
+        }
+
+        unsigned *row = result.rowData(i);
+        for (unsigned j = 0; j < other.columns; ++j) {
+            row[j] = unsigned(accumulator[j] % modulo);
+        }
+    }
+    return result;
+}
+// endregion
+
+// region Operators
+
+std::ostream &operator<<(std::ostream &os, const SparseMatrix &matrix) {
+    for (unsigned i = 0; i < matrix.rows; ++i) {
+        std::size_t k = matrix.rowPointers[i];
+        for (unsigned j = 0; j < matrix.columns; ++j) {
+            if (k < matrix.rowPointers[i + 1] && matrix.columnIndices[k] == j) {
+                os << matrix.values[k++] << " ";
+            } else {
+                os << 0 << " ";
+            }
+        }
+        os << std::endl;
+    }
+    return os;
+}
+
+Matrix operator-(const Matrix &lhs, const SparseMatrix &rhs) {
+    return rhs.subtractFrom(lhs);
+}
+
+SparseMatrix operator+(const SparseMatrix &lhs, const SparseMatrix &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+SparseMatrix operator-(const SparseMatrix &lhs, const SparseMatrix &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+SparseMatrix operator*(const SparseMatrix &lhs, const SparseMatrix &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+
+Matrix operator+(const SparseMatrix &lhs, const Matrix &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+Matrix operator+(const Matrix &lhs, const SparseMatrix &rhs) {
+    return rhs.addStatic(lhs);
+}
+
+Matrix operator-(const SparseMatrix &lhs, const Matrix &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+SparseMatrix operator*(const SparseMatrix &lhs, const Matrix &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+
+SparseMatrix operator*(const Matrix &lhs, const SparseMatrix &rhs) {
+    return rhs.multiplyStatic(lhs);
+}
+// endregion
+
+// region Private Methods
+
+void SparseMatrix::checkArguments(unsigned rows, unsigned columns, unsigned modulo) {
+    if (modulo < 1) {
+        throw std::invalid_argument("modulo cannot be zero or less");
+    }
+
+    if (rows < 1) {
+        throw std::runtime_error("rows cannot be less than 1");
+    }
+
+    if (columns < 1) {
+        throw std::runtime_error("columns cannot be less than 1");
+    }
+}
+
+void SparseMatrix::checkModulo(unsigned otherModulo) const {
+    if (otherModulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+}
+
+template<typename Combine>
+SparseMatrix SparseMatrix::merge(const SparseMatrix &other, bool keepUnmatched, Combine combine) const {
+    checkModulo(other.modulo);
+    SparseMatrix result(std::max(rows, other.rows), std::max(columns, other.columns), modulo);
+    result.columnIndices.reserve(keepUnmatched ? values.size() + other.values.size()
+                                               : std::min(values.size(), other.values.size()));
+    result.values.reserve(result.columnIndices.capacity());
+
+    auto push = [&result](unsigned column, unsigned value) {
+        if (value != 0) {
+            result.columnIndices.push_back(column);
+            result.values.push_back(value);
+        }
+    };
+
+    for (unsigned i = 0; i < result.rows; ++i) {
+        // A row outside of a matrix is an empty row
+        std::size_t k = i < rows ? rowPointers[i] : 0, kEnd = i < rows ? rowPointers[i + 1] : 0;
+        std::size_t l = i < other.rows ? other.rowPointers[i] : 0, lEnd = i < other.rows ? other.rowPointers[i + 1] : 0;
+
+        // Both rows are sorted by column index, walk them together
+        while (k < kEnd || l < lEnd) {
+            if (l == lEnd || (k < kEnd && columnIndices[k] < other.columnIndices[l])) {
+                if (keepUnmatched) {
+                    push(columnIndices[k], combine(values[k], 0));
+                }
+                ++k;
+            } else if (k == kEnd || other.columnIndices[l] < columnIndices[k]) {
+                if (keepUnmatched) {
+                    push(other.columnIndices[l], combine(0, other.values[l]));
+                }
+                ++l;
+            } else {
+                push(columnIndices[k], combine(values[k], other.values[l]));
+                ++k;
+                ++l;
+            }
+        }
+        result.rowPointers[i + 1] = result.values.size();
+    }
+    return result;
+}
+
+Matrix SparseMatrix::paddedCopy(const Matrix &dense) const {
+    if (dense.rows >= rows && dense.columns >= columns) {
+        return dense;
+    }
+
+    Matrix result = Matrix::zeros(std::max(rows, dense.rows), std::max(columns, dense.columns), modulo);
+    for (unsigned i = 0; i < dense.rows; ++i) {
+        std::memcpy(result.rowData(i), dense.rowData(i), dense.columns * sizeof(unsigned));
+    }
+    return result;
+}
+
+Matrix SparseMatrix::subtractFrom(const Matrix &dense) const {
+    checkModulo(dense.modulo);
+    Matrix result = paddedCopy(dense);
+
+    // Only the non-zero elements change the dense copy
+    for (unsigned i = 0; i < rows; ++i) {
+        unsigned *row = result.rowData(i);
+        for (std::size_t k = rowPointers[i]; k < rowPointers[i + 1]; ++k) {
+            row[columnIndices[k]] = Modular::sub(row[columnIndices[k]], values[k], modulo);
+        }
+    }
+    return result;
+}
+// endregion
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class SparseMatrix
+ * @brief Represents a matrix with elements stored modulo n in the Compressed Sparse Row (CSR) format.
+ * @authors Slimani Walid, Van Hove Timothée
+ * Only the non-zero elements are stored, so the memory footprint and the cost of the operations scale with the
+ * number of non-zero elements instead of rows x columns. The semantics are the same as Matrix: both operands must
+ * have the same modulo and an operand smaller than the other one is considered padded with zeros.
+ * The Compressed Sparse Column (CSC) form of a matrix is the CSR form of its transpose, see transpose().
+ */
+class SparseMatrix {
+public:
+    /** @brief An element given by its coordinates, used to build a sparse matrix. */
+    struct Entry {
+        unsigned row;
+        unsigned column;
+        unsigned value;
+    };
+
+private:
+    // region Fields
+    unsigned rows, columns, modulo;
+
+    // Offset of the first element of each row in columnIndices and values, rows + 1 offsets
+    std::vector<std::size_t> rowPointers;
+
+    // Column index of each non-zero element, sorted within a row
+    std::vector<unsigned> columnIndices;
+
+    // Value of each non-zero element, never 0
+    std::vector<unsigned> values;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Checks that the given matrix dimensions and modulo are valid.
+     * @throws std::invalid_argument if the modulo is 0.
+     * @throws std::runtime_error if the number of rows or columns is 0.
+     */
+    static void checkArguments(unsigned rows, unsigned columns, unsigned modulo);
+
+    /**
+     * @brief Checks that the modulo of another matrix is the same as the one of this matrix.
+     * @param otherModulo The modulo of the other matrix.
+     * @throws std::invalid_argument if the moduli are different.
+     */
+    void checkModulo(unsigned otherModulo) const;
+
+    /**
+     * @brief Merges the non-zero elements of this matrix with the ones of another sparse matrix, row by row.
+     * @param other The other sparse matrix.
+     * @param keepUnmatched true if the elements present in only one of the operands are combined with 0
+     * (addition, subtraction), false if they can be skipped because the result is known to be 0 (multiplication).
+     * @param combine The modular operation applied to each pair of elements.
+     * @return The resulting sparse matrix.
+     */
+    template<typename Combine>
+    [[nodiscard]] SparseMatrix merge(const SparseMatrix &other, bool keepUnmatched, Combine combine) const;
+
+    /**
+     * @brief Copies a dense matrix into a new dense matrix large enough to hold this sparse matrix.
+     * @param dense The dense matrix to copy.
+     * @return A copy of the dense matrix padded with zeros.
+     */
+    [[nodiscard]] Matrix paddedCopy(const Matrix &dense) const;
+
+    /**
+     * @brief Creates a new dense matrix that is the result of subtracting this matrix from a dense matrix.
+     * @param dense The dense matrix to subtract this matrix from.
+     * @return A new Matrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] Matrix subtractFrom(const Matrix &dense) const;
+
+    // endregion
+
+public:
+    // region Ctors
+    SparseMatrix() = delete;
+
+    /**
+    * @brief Constructs a SparseMatrix whose elements are all 0.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param modulo The modulo value for matrix operations.
+    */
+    SparseMatrix(unsigned rows, unsigned columns, unsigned modulo);
+
+    /**
+    * @brief Constructs a SparseMatrix from a list of elements.
+    * The values are reduced modulo n, the elements with the same coordinates are summed and the zeros are dropped.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param modulo The modulo value for matrix operations.
+    * @param entries The elements of the matrix, in any order.
+    * @throws std::out_of_range if an element is outside the matrix.
+    */
+    SparseMatrix(unsigned rows, unsigned columns, unsigned modulo, std::vector<Entry> entries);
+
+    /**
+    * @brief Constructs a SparseMatrix holding the non-zero elements of a dense matrix.
+    * @param dense The dense matrix to convert.
+    */
+    explicit SparseMatrix(const Matrix &dense);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of rows of the matrix. */
+    [[nodiscard]] unsigned getRows() const { return rows; }
+
+    /** @return The number of columns of the matrix. */
+    [[nodiscard]] unsigned getColumns() const { return columns; }
+
+    /** @return The modulo applied to the elements of the matrix. */
+    [[nodiscard]] unsigned getModulo() const { return modulo; }
+
+    /** @return The number of non-zero elements stored in the matrix. */
+    [[nodiscard]] std::size_t nonZeros() const { return values.size(); }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element, 0 if it is not stored.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    [[nodiscard]] unsigned get(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Converts this matrix to a dense Matrix.
+     * @return The dense matrix holding the same elements.
+     */
+    [[nodiscard]] Matrix toDense() const;
+
+    /**
+     * @brief Creates the transpose of this matrix, which is also the CSC form of this matrix.
+     * @return The transposed matrix.
+     */
+    [[nodiscard]] SparseMatrix transpose() const;
+
+    /**
+     * @brief Adds another sparse matrix to this matrix in-place.
+     * @param other The matrix to be added to this matrix.
+     * @return A reference to this matrix after the addition.
+     */
+    SparseMatrix &add(const SparseMatrix &other);
+
+    /**
+     * @brief Creates a new sparse matrix that is the result of adding another sparse matrix to this matrix.
+     * @param other The matrix to be added to this matrix.
+     * @return A new SparseMatrix instance that is the result of the addition.
+     */
+    [[nodiscard]] SparseMatrix addStatic(const SparseMatrix &other) const;
+
+    /**
+     * @brief Creates a new dense matrix that is the result of adding a dense matrix to this matrix.
+     * @param other The matrix to be added to this matrix.
+     * @return A new Matrix instance that is the result of the addition.
+     */
+    [[nodiscard]] Matrix addStatic(const Matrix &other) const;
+
+    /**
+     * @brief Subtracts another sparse matrix to this matrix in-place.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A reference to this matrix after the subtraction.
+     */
+    SparseMatrix &sub(const SparseMatrix &other);
+
+    /**
+     * @brief Creates a new sparse matrix that is the result of subtracting another sparse matrix to this matrix.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A new SparseMatrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] SparseMatrix subStatic(const SparseMatrix &other) const;
+
+    /**
+     * @brief Creates a new dense matrix that is the result of subtracting a dense matrix to this matrix.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A new Matrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] Matrix subStatic(const Matrix &other) const;
+
+    /**
+     * @brief Multiplies (component by component) another sparse matrix to this matrix in-place.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A reference to this matrix after the multiplication.
+     */
+    SparseMatrix &multiply(const SparseMatrix &other);
+
+    /**
+     * @brief Creates a new sparse matrix that is the component by component product of this matrix and another one.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A new SparseMatrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] SparseMatrix multiplyStatic(const SparseMatrix &other) const;
+
+    /**
+     * @brief Creates a new sparse matrix that is the component by component product of this matrix and a dense one.
+     * Only the non-zero elements of this matrix are visited, the result is therefore sparse as well.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A new SparseMatrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] SparseMatrix multiplyStatic(const Matrix &other) const;
+
+    /**
+     * @brief Computes the matrix product of this matrix with a dense matrix.
+     * @param other The right-hand side dense matrix, its number of rows must be the number of columns of this matrix.
+     * @return A new Matrix instance that is the result of the product.
+     * @throws std::invalid_argument if the moduli or the inner dimensions are different.
+     */
+    [[nodiscard]] Matrix product(const Matrix &other) const;
+
+    // endregion
+
+    // region Operators
+
+    /**
+    * @brief Stream insertion operator for SparseMatrix class, prints the matrix in its dense form.
+    * @param os The output stream to insert into.
+    * @param matrix The SparseMatrix object to insert into the stream.
+    * @return A reference to the modified output stream.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const SparseMatrix &matrix);
+
+    /**
+     * @brief Subtracts a sparse matrix from a dense matrix.
+     * @param lhs The left-hand side dense matrix.
+     * @param rhs The right-hand side sparse matrix.
+     * @return A new dense matrix that is the result of the subtraction.
+     */
+    friend Matrix operator-(const Matrix &lhs, const SparseMatrix &rhs);
+    // endregion
+};
+
+/**
+ * @brief Adds two sparse matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new sparse matrix that is the result of adding the two matrices.
+ */
+SparseMatrix operator+(const SparseMatrix &lhs, const SparseMatrix &rhs);
+
+/**
+ * @brief Subtracts two sparse matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new sparse matrix that is the result of subtracting the two matrices.
+ */
+SparseMatrix operator-(const SparseMatrix &lhs, const SparseMatrix &rhs);
+
+/**
+ * @brief Multiplies two sparse matrices component by component.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new sparse matrix that is the result of multiplying the two matrices.
+ */
+SparseMatrix operator*(const SparseMatrix &lhs, const SparseMatrix &rhs);
+
+/**
+ * @brief Adds a dense matrix to a sparse matrix.
+ * @param lhs The left-hand side sparse matrix.
+ * @param rhs The right-hand side dense matrix.
+ * @return A new dense matrix that is the result of adding the two matrices.
+ */
+Matrix operator+(const SparseMatrix &lhs, const Matrix &rhs);
+
+/**
+ * @brief Adds a sparse matrix to a dense matrix.
+ * @param lhs The left-hand side dense matrix.
+ * @param rhs The right-hand side sparse matrix.
+ * @return A new dense matrix that is the result of adding the two matrices.
+ */
+Matrix operator+(const Matrix &lhs, const SparseMatrix &rhs);
+
+/**
+ * @brief Subtracts a dense matrix from a sparse matrix.
+ * @param lhs The left-hand side sparse matrix.
+ * @param rhs The right-hand side dense matrix.
+ * @return A new dense matrix that is the result of the subtraction.
+ */
+Matrix operator-(const SparseMatrix &lhs, const Matrix &rhs);
+
+/**
+ * @brief Multiplies a sparse matrix and a dense matrix component by component.
+ * @param lhs The left-hand side sparse matrix.
+ * @param rhs The right-hand side dense matrix.
+ * @return A new sparse matrix that is the result of the multiplication.
+ */
+SparseMatrix operator*(const SparseMatrix &lhs, const Matrix &rhs);
+
+/**
+ * @brief Multiplies a dense matrix and a sparse matrix component by component.
+ * @param lhs The left-hand side dense matrix.
+ * @param rhs The right-hand side sparse matrix.
+ * @return A new sparse matrix that is the result of the multiplication.
+ */
+SparseMatrix operator*(const Matrix &lhs, const SparseMatrix &rhs);
@@ -0,0 +1,266 @@
+#include "TiledMatrix.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include "../Utils/Modular.h"
+#include "../Utils/Parallel.h"
+#include "../Utils/Tuning.h"
+
+// region Constructors
+
+TiledMatrix::TiledMatrix(unsigned rows, unsigned columns, unsigned modulo)
+        : rows(rows), columns(columns), modulo(modulo),
+          tileRows((rows + TILE - 1) / TILE), tileColumns((columns + TILE - 1) / TILE) {
+    if (modulo < 1) {
+        throw std::invalid_argument("modulo cannot be zero or less");
+    }
+
+    if (rows < 1) {
+        throw std::runtime_error("rows cannot be less than 1");
+    }
+
+    if (columns < 1) {
+        throw std::runtime_error("columns cannot be less than 1");
+    }
+
+    // Rank the tiles along the Z-order curve. The gaps of the curve outside a grid that is not a square of a power of
+    // two are skipped, so the tiles stay packed.
+    const std::size_t tiles = std::size_t(tileRows) * tileColumns;
+    std::vector<std::size_t> order(tiles);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+        return mortonCode(unsigned(lhs / tileColumns), unsigned(lhs % tileColumns)) <
+               mortonCode(unsigned(rhs / tileColumns), unsigned(rhs % tileColumns));
+    });
+
+    tilePositions.resize(tiles);
+    for (std::size_t position = 0; position < tiles; ++position) {
+        tilePositions[order[position]] = position;
+    }
+    data.assign(tiles * TILE_ELEMENTS, 0);
+}
+
+TiledMatrix::TiledMatrix(const Matrix &dense) : TiledMatrix(dense.rows, dense.columns, dense.modulo) {
+    for (unsigned r = 0; r < tileRows; ++r) {
+        const unsigned rowsInTile = std::min(TILE, rows - r * TILE);
+        for (unsigned c = 0; c < tileColumns; ++c) {
+            const unsigned columnsInTile = std::min(TILE, columns - c * TILE);
+            unsigned *elements = tile(r, c);
+            for (unsigned i = 0; i < rowsInTile; ++i) {
+                const unsigned *denseRow = dense.rowData(r * TILE + i) + std::size_t(c) * TILE;
+                std::copy(denseRow, denseRow + columnsInTile, elements + std::size_t(i) * TILE);
+            }
+        }
+    }
+}
+// endregion
+
+// region Public Methods
+
+unsigned TiledMatrix::get(unsigned rowIndex, unsigned columnIndex) const {
+    if (rowIndex >= rows || columnIndex >= columns) {
+        throw std::out_of_range("The indices are outside the matrix");
+    }
+    return tile(rowIndex / TILE, columnIndex / TILE)[(rowIndex % TILE) * TILE + columnIndex % TILE];
+}
+
+Matrix TiledMatrix::toMatrix() const {
+    Matrix result = Matrix::zeros(rows, columns, modulo);
+    for (unsigned r = 0; r < tileRows; ++r) {
+        const unsigned rowsInTile = std::min(TILE, rows - r * TILE);
+        for (unsigned c = 0; c < tileColumns; ++c) {
+            const unsigned columnsInTile = std::min(TILE, columns - c * TILE);
+            const unsigned *elements = tile(r, c);
+            for (unsigned i = 0; i < rowsInTile; ++i) {
+                const unsigned *tileRow = elements + std::size_t(i) * TILE;
+                std::copy(tileRow, tileRow + columnsInTile, result.rowData(r * TILE + i) + std::size_t(c) * TILE);
+            }
+        }
+    }
+    return result;
+}
+
+// region Add
+TiledMatrix &TiledMatrix::add(const TiledMatrix &other) {
+    const unsigned n = modulo;
+    applyOperator(other, [n](unsigned lhs, unsigned rhs) { return Modular::add(lhs, rhs, n); });
+    return *this;
+}
+
+TiledMatrix TiledMatrix::addStatic(const TiledMatrix &other) const {
+    TiledMatrix result(*this);
+    result.add(other);
+    return result;
+}
+// endregion
+
+// region Sub
+TiledMatrix &TiledMatrix::sub(const TiledMatrix &other) {
+    const unsigned n = modulo;
+    applyOperator(other, [n](unsigned lhs, unsigned rhs) { return Modular::sub(lhs, rhs, n); });
+    return *this;
+}
+
+TiledMatrix TiledMatrix::subStatic(const TiledMatrix &other) const {
+    TiledMatrix result(*this);
+    result.sub(other);
+    return result;
+}
+// endregion
+
+// region Multiply
+TiledMatrix &TiledMatrix::multiply(const TiledMatrix &other) {
+    const unsigned n = modulo;
+    applyOperator(other, [n](unsigned lhs, unsigned rhs) { return Modular::multiply(lhs, rhs, n); });
+    return *this;
+}
+
+TiledMatrix TiledMatrix::multiplyStatic(const TiledMatrix &other) const {
+    TiledMatrix result(*this);
+    result.multiply(other);
+    return result;
+}
+// endregion
+
+TiledMatrix TiledMatrix::product(const TiledMatrix &other) const {
+    if (other.modulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+
+    if (columns != other.rows) {
+        throw std::invalid_argument("The number of columns of the left matrix must be the number of rows of the right one");
+    }
+
+    TiledMatrix result(rows, other.columns, modulo);
+    const uint64_t interval = Modular::reductionInterval(modulo);
+
+    // A row of tiles of the result costs TILE * columns * other.columns multiply-adds
+    const std::size_t tileRowGrain = std::max<std::size_t>(1, Tuning::productGrain() /
+                                                              (std::size_t(TILE) * columns * other.columns));
+    Parallel::forRange(0, tileRows, tileRowGrain, [&](std::size_t firstTileRow, std::size_t lastTileRow) {
+        std::vector<uint64_t> accumulators(TILE_ELEMENTS);
+        for (auto r = unsigned(firstTileRow); r < lastTileRow; ++r) {
+            for (unsigned c = 0; c < result.tileColumns; ++c) {
+                std::fill(accumulators.begin(), accumulators.end(), 0);
+                uint64_t pending = 0;
+
+                // The padding of the tiles is 0, so the full tiles can be multiplied
+                for (unsigned k = 0; k < tileColumns; ++k) {
+                    const unsigned *lhs = tile(r, k), *rhs = other.tile(k, c);
+                    for (unsigned inner = 0; inner < TILE; ++inner) {
+                        const unsigned *rhsRow = rhs + std::size_t(inner) * TILE;
+                        for (unsigned i = 0; i < TILE; ++i) {
+                            const uint64_t value = lhs[std::size_t(i) * TILE + inner];
+                            uint64_t *accumulatorRow = accumulators.data() + std::size_t(i) * TILE;
+                            for (unsigned j = 0; j < TILE; ++j) {
+                                accumulatorRow[j] += value * rhsRow[j];
+                            }
+                        }
+
+                        // Each accumulator received one more product
+                        if (++pending == interval) {
+                            for (uint64_t &accumulator: accumulators) {
+                                accumulator %= modulo;
+                            }
+                            pending = 0;
+                        }
+                    }
+                }
+
+                unsigned *elements = result.tile(r, c);
+                for (std::size_t e = 0; e < TILE_ELEMENTS; ++e) {
+                    elements[e] = unsigned(accumulators[e] % modulo);
+                }
+            }
+        }
+    });
+    return result;
+}
+// endregion
+
+// region Operators
+
+std::ostream &operator<<(std::ostream &os, const TiledMatrix &matrix) {
+    for (unsigned i = 0; i < matrix.rows; ++i) {
+        for (unsigned j = 0; j < matrix.columns; ++j) {
+            os << matrix.get(i, j) << " ";
+        }
+        os << std::endl;
+    }
+    return os;
+}
+
+TiledMatrix operator+(const TiledMatrix &lhs, const TiledMatrix &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+TiledMatrix operator-(const TiledMatrix &lhs, const TiledMatrix &rhs) {
+    return lhs.subStatic(rhs);
+}
+
+TiledMatrix operator*(const TiledMatrix &lhs, const TiledMatrix &rhs) {
+    return lhs.multiplyStatic(rhs);
+}
+// endregion
+
+// region Private Methods
+
+uint64_t TiledMatrix::mortonCode(unsigned tileRow, unsigned tileColumn) {
+    // Spread the 32 bits of a coordinate over the even bits of a 64 bits word
+    auto spread = [](uint64_t value) {
+        value = (value | (value << 16)) & 0x0000FFFF0000FFFFull;
+        value = (value | (value << 8)) & 0x00FF00FF00FF00FFull;
+        value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        value = (value | (value << 2)) & 0x3333333333333333ull;
+        value = (value | (value << 1)) & 0x5555555555555555ull;
+        return value;
+    };
+    return (spread(tileRow) << 1) | spread(tileColumn);
+}
+
+void TiledMatrix::grow(unsigned newRows, unsigned newColumns) {
+    if (newRows == rows && newColumns == columns) {
+        return;
+    }
+
+    // The tiles keep their elements, only their position changes with the size of the grid
+    TiledMatrix result(newRows, newColumns, modulo);
+    for (unsigned r = 0; r < tileRows; ++r) {
+        for (unsigned c = 0; c < tileColumns; ++c) {
+            std::copy(tile(r, c), tile(r, c) + TILE_ELEMENTS, result.tile(r, c));
+        }
+    }
+    *this = std::move(result);
+}
+
+template<typename ElementOperation>
+void TiledMatrix::applyOperator(const TiledMatrix &other, ElementOperation op) {
+    if (other.modulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 matrices must be identical");
+    }
+
+    // Does not grow when the other matrix is this matrix
+    grow(std::max(rows, other.rows), std::max(columns, other.columns));
+
+    // The padding of the tiles is 0 and op(0, 0) = 0, so the full tiles can be processed. The tiles outside the grid
+    // of the other matrix are combined with 0.
+    const std::size_t tiles = std::size_t(tileRows) * tileColumns;
+    Parallel::forRange(0, tiles, std::max<std::size_t>(1, Tuning::elementGrain() / TILE_ELEMENTS),
+                       [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; ++t) {
+            const auto r = unsigned(t / tileColumns), c = unsigned(t % tileColumns);
+            unsigned *elements = tile(r, c);
+            if (r < other.tileRows && c < other.tileColumns) {
+                const unsigned *otherElements = other.tile(r, c);
+                for (std::size_t e = 0; e < TILE_ELEMENTS; ++e) {
+                    elements[e] = op(elements[e], otherElements[e]);
+                }
+            } else {
+                for (std::size_t e = 0; e < TILE_ELEMENTS; ++e) {
+                    elements[e] = op(elements[e], 0);
+                }
+            }
+        }
+    });
+}
+// endregion
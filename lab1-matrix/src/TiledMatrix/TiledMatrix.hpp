@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "../Matrix/Matrix.hpp"
+
+/**
+ * @class TiledMatrix
+ * @brief Represents a matrix with elements stored modulo n, split in square tiles stored in Morton (Z) order.
+ * @authors Slimani Walid, Van Hove Timothée
+ * Each tile of TILE x TILE elements is contiguous (row after row inside the tile) and the tiles follow the Z-order
+ * curve over the grid of tiles, so tiles close in the matrix are close in memory whatever the direction of the access.
+ * A tile fits in the L1 cache: the matrix product works tile by tile and a column of tiles is read as efficiently as
+ * a row of tiles, which keeps the product cache friendly on matrices much larger than the last level cache.
+ * The semantics are the same as Matrix: an operand smaller than the other one is considered padded with zeros.
+ */
+class TiledMatrix {
+private:
+    // region Fields
+
+    // Size of the side of a tile, a tile of unsigned takes 4 KB
+    static constexpr unsigned TILE = 32;
+    static constexpr std::size_t TILE_ELEMENTS = std::size_t(TILE) * TILE;
+
+    unsigned rows, columns, modulo;
+    unsigned tileRows, tileColumns;
+
+    // Position in data (in tiles) of the tile (r, c), stored at r * tileColumns + c
+    std::vector<std::size_t> tilePositions;
+
+    // Tiles stored one after the other in Morton order, the elements of a tile outside the matrix are always 0
+    std::vector<unsigned> data;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Interleaves the bits of the coordinates of a tile, the order of the tiles along the Z-order curve.
+     * @param tileRow The row of the tile.
+     * @param tileColumn The column of the tile.
+     * @return The Morton code of the tile.
+     */
+    static uint64_t mortonCode(unsigned tileRow, unsigned tileColumn);
+
+    /**
+     * @brief Gives a direct access to the elements of a tile.
+     * @param tileRow The row of the tile, must be lower than the number of rows of tiles.
+     * @param tileColumn The column of the tile, must be lower than the number of columns of tiles.
+     * @return A pointer to the first element of the tile.
+     */
+    [[nodiscard]] unsigned *tile(unsigned tileRow, unsigned tileColumn) {
+        return data.data() + tilePositions[std::size_t(tileRow) * tileColumns + tileColumn] * TILE_ELEMENTS;
+    }
+
+    /**
+     * @brief Gives a read-only access to the elements of a tile.
+     * @param tileRow The row of the tile, must be lower than the number of rows of tiles.
+     * @param tileColumn The column of the tile, must be lower than the number of columns of tiles.
+     * @return A pointer to the first element of the tile.
+     */
+    [[nodiscard]] const unsigned *tile(unsigned tileRow, unsigned tileColumn) const {
+        return data.data() + tilePositions[std::size_t(tileRow) * tileColumns + tileColumn] * TILE_ELEMENTS;
+    }
+
+    /**
+     * @brief Grows the matrix to the given size, the new elements are 0.
+     * @param newRows The new number of rows, must not be lower than the current one.
+     * @param newColumns The new number of columns, must not be lower than the current one.
+     */
+    void grow(unsigned newRows, unsigned newColumns);
+
+    /**
+     * @brief Applies an operation to each element of this matrix with the same element of another matrix.
+     * @param other The other matrix to operate with.
+     * @param op The modular operation to apply on two elements.
+     * @throws std::invalid_argument if the modulo of the matrices are different.
+     */
+    template<typename ElementOperation>
+    void applyOperator(const TiledMatrix &other, ElementOperation op);
+
+    // endregion
+
+public:
+    // region Ctors
+    TiledMatrix() = delete;
+
+    /**
+    * @brief Constructs a TiledMatrix whose elements are all 0.
+    * @param rows Number of rows in the matrix.
+    * @param columns Number of columns in the matrix.
+    * @param modulo The modulo value for matrix operations.
+    */
+    TiledMatrix(unsigned rows, unsigned columns, unsigned modulo);
+
+    /**
+    * @brief Constructs a TiledMatrix holding the elements of a row-major matrix.
+    * @param dense The matrix to convert.
+    */
+    explicit TiledMatrix(const Matrix &dense);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of rows of the matrix. */
+    [[nodiscard]] unsigned getRows() const { return rows; }
+
+    /** @return The number of columns of the matrix. */
+    [[nodiscard]] unsigned getColumns() const { return columns; }
+
+    /** @return The modulo applied to the elements of the matrix. */
+    [[nodiscard]] unsigned getModulo() const { return modulo; }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param rowIndex The row index.
+     * @param columnIndex The column index.
+     * @return The value of the element.
+     * @throws std::out_of_range if the indices are outside the matrix.
+     */
+    [[nodiscard]] unsigned get(unsigned rowIndex, unsigned columnIndex) const;
+
+    /**
+     * @brief Converts this matrix to a row-major Matrix.
+     * @return The row-major matrix holding the same elements.
+     */
+    [[nodiscard]] Matrix toMatrix() const;
+
+    /**
+     * @brief Adds another matrix to this matrix in-place.
+     * @param other The matrix to be added to this matrix.
+     * @return A reference to this matrix after the addition.
+     */
+    TiledMatrix &add(const TiledMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the result of adding another matrix to this matrix.
+     * @param other The matrix to be added to this matrix.
+     * @return A new TiledMatrix instance that is the result of the addition.
+     */
+    [[nodiscard]] TiledMatrix addStatic(const TiledMatrix &other) const;
+
+    /**
+     * @brief Subtracts another matrix to this matrix in-place.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A reference to this matrix after the subtraction.
+     */
+    TiledMatrix &sub(const TiledMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the result of subtracting another matrix to this matrix.
+     * @param other The matrix to be subtracted to this matrix.
+     * @return A new TiledMatrix instance that is the result of the subtraction.
+     */
+    [[nodiscard]] TiledMatrix subStatic(const TiledMatrix &other) const;
+
+    /**
+     * @brief Multiplies (component by component) another matrix to this matrix in-place.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A reference to this matrix after the multiplication.
+     */
+    TiledMatrix &multiply(const TiledMatrix &other);
+
+    /**
+     * @brief Creates a new matrix that is the component by component product of this matrix and another one.
+     * @param other The matrix to be multiplied to this matrix.
+     * @return A new TiledMatrix instance that is the result of the multiplication.
+     */
+    [[nodiscard]] TiledMatrix multiplyStatic(const TiledMatrix &other) const;
+
+    /**
+     * @brief Computes the matrix product of this matrix with another one, tile by tile.
+     * Each tile of the result accumulates the products of a row of tiles of this matrix and a column of tiles of the
+     * other one in 64 bits, reduced only when the accumulators could overflow. The rows of tiles are split across
+     * threads.
+     * @param other The right-hand side matrix, its number of rows must be the number of columns of this matrix.
+     * @return A new TiledMatrix instance that is the result of the product.
+     * @throws std::invalid_argument if the modulo or the inner dimensions are different.
+     */
+    [[nodiscard]] TiledMatrix product(const TiledMatrix &other) const;
+
+    // endregion
+
+    // region Operators
+
+    /**
+    * @brief Stream insertion operator for TiledMatrix class, prints the elements in row-major order.
+    * @param os The output stream to insert into.
+    * @param matrix The TiledMatrix object to insert into the stream.
+    * @return A reference to the modified output stream.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const TiledMatrix &matrix);
+    // endregion
+};
+
+/**
+ * @brief Adds two tiled matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of adding the two matrices.
+ */
+TiledMatrix operator+(const TiledMatrix &lhs, const TiledMatrix &rhs);
+
+/**
+ * @brief Subtracts two tiled matrices.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of subtracting the two matrices.
+ */
+TiledMatrix operator-(const TiledMatrix &lhs, const TiledMatrix &rhs);
+
+/**
+ * @brief Multiplies two tiled matrices component by component.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return A new matrix that is the result of multiplying the two matrices.
+ */
+TiledMatrix operator*(const TiledMatrix &lhs, const TiledMatrix &rhs);
@@ -0,0 +1,61 @@
+#include "BigUnsigned.h"
+#include <algorithm>
+
+BigUnsigned::BigUnsigned(uint64_t value) {
+    for (; value != 0; value >>= 32) {
+        words.push_back(uint32_t(value));
+    }
+}
+
+BigUnsigned &BigUnsigned::multiplyAdd(uint32_t factor, uint32_t addend) {
+    uint64_t carry = addend;
+    for (uint32_t &word: words) {
+        const uint64_t value = uint64_t(word) * factor + carry;
+        word = uint32_t(value);
+        carry = value >> 32;
+    }
+    if (carry != 0) {
+        words.push_back(uint32_t(carry));
+    }
+    while (!words.empty() && words.back() == 0) {
+        words.pop_back();
+    }
+    return *this;
+}
+
+uint32_t BigUnsigned::divide(uint32_t divisor) {
+    uint64_t remainder = 0;
+    for (auto word = words.rbegin(); word != words.rend(); ++word) {
+        const uint64_t value = remainder << 32 | *word;
+        *word = uint32_t(value / divisor);
+        remainder = value % divisor;
+    }
+    while (!words.empty() && words.back() == 0) {
+        words.pop_back();
+    }
+    return uint32_t(remainder);
+}
+
+std::string BigUnsigned::toString() const {
+    if (isZero()) {
+        return "0";
+    }
+
+    // Groups of 9 decimal digits, from the least significant one
+    const uint32_t GROUP = 1000000000;
+    BigUnsigned quotient(*this);
+    std::string digits;
+    while (!quotient.isZero()) {
+        uint32_t group = quotient.divide(GROUP);
+        for (int i = 0; i < 9 && (group != 0 || !quotient.isZero()); ++i) {
+            digits.push_back(char('0' + group % 10));
+            group /= 10;
+        }
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+std::ostream &operator<<(std::ostream &os, const BigUnsigned &number) {
+    return os << number.toString();
+}
@@ -0,0 +1,72 @@
+#ifndef LABMATRIX_BIGUNSIGNED_H
+#define LABMATRIX_BIGUNSIGNED_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class BigUnsigned
+ * @brief Minimal arbitrary precision natural number, used to export the values reconstructed from residues
+ * @authors Slimani Walid, Van Hove Timothée
+ * Only the operations needed by the mixed radix reconstruction are provided: multiplying by a word and adding a word,
+ * comparing and printing in base 10.
+ */
+class BigUnsigned {
+private:
+    // Words of 32 bits, least significant first, without trailing 0 (0 has no word)
+    std::vector<uint32_t> words;
+
+public:
+    /**
+     * @brief Constructs a number from a machine integer.
+     * @param value The value.
+     */
+    BigUnsigned(uint64_t value = 0);
+
+    /**
+     * @brief Multiplies this number by a word then adds a word in-place: this = this * factor + addend.
+     * @param factor The factor.
+     * @param addend The value added after the product.
+     * @return A reference to this number after the operation.
+     */
+    BigUnsigned &multiplyAdd(uint32_t factor, uint32_t addend);
+
+    /**
+     * @brief Divides this number by a word in-place.
+     * @param divisor The divisor, must not be 0.
+     * @return The remainder of the division.
+     */
+    uint32_t divide(uint32_t divisor);
+
+    /** @return true if the number is 0, false otherwise. */
+    [[nodiscard]] bool isZero() const { return words.empty(); }
+
+    /** @return The decimal representation of the number. */
+    [[nodiscard]] std::string toString() const;
+
+    /**
+     * @brief Equality operator for BigUnsigned class.
+     * @param other The other number.
+     * @return true if both numbers are equal, false otherwise.
+     */
+    bool operator==(const BigUnsigned &other) const { return words == other.words; }
+
+    /**
+     * @brief Inequality operator for BigUnsigned class.
+     * @param other The other number.
+     * @return true if the numbers are different, false otherwise.
+     */
+    bool operator!=(const BigUnsigned &other) const { return words != other.words; }
+
+    /**
+     * @brief Stream insertion operator for BigUnsigned class, prints the number in base 10.
+     * @param os The output stream to insert into.
+     * @param number The number to insert into the stream.
+     * @return A reference to the modified output stream.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const BigUnsigned &number);
+};
+
+#endif //LABMATRIX_BIGUNSIGNED_H
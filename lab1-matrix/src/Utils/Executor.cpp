@@ -0,0 +1,56 @@
+#include "Executor.h"
+#include <algorithm>
+#include "Parallel.h"
+
+Executor::Executor(unsigned threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(2u, std::thread::hardware_concurrency());
+    }
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&Executor::work, this);
+    }
+}
+
+Executor::~Executor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for (std::thread &worker: workers) {
+        worker.join();
+    }
+}
+
+void Executor::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+Executor &Executor::shared() {
+    static Executor executor;
+    return executor;
+}
+
+void Executor::work() {
+    // The tasks already run concurrently, the loops of their kernels stay on this thread
+    Parallel::Sequential sequential;
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+            // The queue is emptied before stopping, a task may post the tasks depending on it
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef LABMATRIX_EXECUTOR_H
+#define LABMATRIX_EXECUTOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class Executor
+ * @brief Pool of threads running the submitted tasks in their order of submission
+ * @authors Slimani Walid, Van Hove Timothée
+ * The tasks of the asynchronous operations run on an executor. The executor threads already run concurrently, so the
+ * parallel loops of the kernels called by a task run on its thread (see Parallel::Sequential).
+ */
+class Executor {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    bool stopping = false;
+
+    /** @brief Runs the tasks of the queue until the executor is destroyed. */
+    void work();
+
+public:
+    /**
+     * @brief Starts the threads of the pool.
+     * @param threadCount The number of threads, 0 for the number of hardware threads but at least 2, so that a task
+     * waiting for I/O does not stop the computations.
+     */
+    explicit Executor(unsigned threadCount = 0);
+
+    /** @brief Runs the tasks still queued, then joins the threads. */
+    ~Executor();
+
+    Executor(const Executor &) = delete;
+
+    Executor &operator=(const Executor &) = delete;
+
+    /**
+     * @brief Queues a task.
+     * @param task The task, it should not throw: an exception escaping it terminates the program.
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * @brief Queues a task and gives a future of its result.
+     * @param function The function to call.
+     * @return The future of the value returned, or of the exception thrown, by the function.
+     */
+    template<typename Function>
+    std::future<std::invoke_result_t<Function>> submit(Function function) {
+        using Result = std::invoke_result_t<Function>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::move(function));
+        std::future<Result> future = task->get_future();
+        post([task] { (*task)(); });
+        return future;
+    }
+
+    /** @return The number of threads of the pool. */
+    [[nodiscard]] unsigned getThreadCount() const { return unsigned(workers.size()); }
+
+    /** @return The executor used by default, created on first use and destroyed at exit. */
+    static Executor &shared();
+};
+
+#endif //LABMATRIX_EXECUTOR_H
@@ -0,0 +1,198 @@
+#ifndef LABMATRIX_MODULAR_H
+#define LABMATRIX_MODULAR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class Modular
+ * @brief Helper class that contains the modular arithmetic primitives shared by the matrix kernels
+ * @authors Slimani Walid, Van Hove Timothée
+ * All the operands are expected to be already reduced, i.e. in the range [0, modulo).
+ */
+class Modular {
+public:
+    /**
+     * @brief Adds two reduced values modulo n.
+     * @param n The left value.
+     * @param m The right value.
+     * @param modulo The modulo.
+     * @return (n + m) mod modulo
+     */
+    static constexpr unsigned add(unsigned n, unsigned m, unsigned modulo) {
+        uint64_t sum = uint64_t(n) + m;
+        return unsigned(sum >= modulo ? sum - modulo : sum);
+    }
+
+    /**
+     * @brief Subtracts two reduced values modulo n without underflowing.
+     * @param n The left value.
+     * @param m The right value.
+     * @param modulo The modulo.
+     * @return (n - m) mod modulo
+     */
+    static constexpr unsigned sub(unsigned n, unsigned m, unsigned modulo) {
+        return n >= m ? n - m : n + (modulo - m);
+    }
+
+    /**
+     * @brief Multiplies two reduced values modulo n using a 64 bits intermediate product.
+     * @param n The left value.
+     * @param m The right value.
+     * @param modulo The modulo.
+     * @return (n * m) mod modulo
+     */
+    static constexpr unsigned multiply(unsigned n, unsigned m, unsigned modulo) {
+        return unsigned(uint64_t(n) * m % modulo);
+    }
+
+    /**
+     * @brief Raises a reduced value to a power modulo n by square-and-multiply.
+     * @param n The value.
+     * @param exponent The power, 0^0 is 1.
+     * @param modulo The modulo.
+     * @return n^exponent mod modulo
+     */
+    static constexpr unsigned pow(unsigned n, uint64_t exponent, unsigned modulo) {
+        unsigned result = 1 % modulo;
+        for (; exponent != 0; exponent >>= 1) {
+            if (exponent & 1u) {
+                result = multiply(result, n, modulo);
+            }
+            n = multiply(n, n, modulo);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Computes the inverse of a reduced value modulo n with the extended Euclidean algorithm.
+     * @param n The value, must be coprime with the modulo.
+     * @param modulo The modulo.
+     * @return The value m such that n * m = 1 mod modulo, 0 if n is not invertible.
+     */
+    static constexpr unsigned inverse(unsigned n, unsigned modulo) {
+        int64_t r0 = modulo, r1 = n, t0 = 0, t1 = 1;
+        while (r1 != 0) {
+            const int64_t quotient = r0 / r1;
+            const int64_t r2 = r0 - quotient * r1, t2 = t0 - quotient * t1;
+            r0 = r1;
+            r1 = r2;
+            t0 = t1;
+            t1 = t2;
+        }
+        if (r0 != 1) {
+            return 0;
+        }
+        return unsigned(t0 < 0 ? t0 + modulo : t0) % modulo;
+    }
+
+    /**
+     * @brief Tests whether a number is prime with a Miller-Rabin test, deterministic below 2^32 with the bases 2, 7, 61.
+     * @param n The number.
+     * @return true if the number is prime, false otherwise.
+     */
+    static constexpr bool isPrime(unsigned n) {
+        if (n < 2) {
+            return false;
+        }
+        for (unsigned p: {2u, 3u, 5u, 7u, 61u}) {
+            if (n % p == 0) {
+                return n == p;
+            }
+        }
+
+        // n - 1 = d * 2^s with d odd
+        unsigned d = n - 1, s = 0;
+        while (d % 2 == 0) {
+            d /= 2;
+            ++s;
+        }
+        for (unsigned base: {2u, 7u, 61u}) {
+            unsigned x = pow(base, d, n);
+            if (x == 1 || x == n - 1) {
+                continue;
+            }
+            bool composite = true;
+            for (unsigned i = 1; i < s && composite; ++i) {
+                x = multiply(x, x, n);
+                composite = x != n - 1;
+            }
+            if (composite) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Computes how many reduced values can be summed in a 64 bits accumulator before it must be reduced.
+     * @param modulo The modulo.
+     * @return The number of values that can safely be accumulated, at least 2^32.
+     */
+    static constexpr uint64_t additionInterval(unsigned modulo) {
+        if (modulo <= 1) {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        return (std::numeric_limits<uint64_t>::max() - modulo) / (modulo - 1);
+    }
+
+    /**
+     * @brief Computes how many products of reduced values can be summed in a 64 bits accumulator before it must be reduced.
+     * @note This is what allows the kernels to delay the (costly) modular reduction of a dot product.
+     * @param modulo The modulo.
+     * @return The number of products that can safely be accumulated, at least 1.
+     */
+    static constexpr uint64_t reductionInterval(unsigned modulo) {
+        if (modulo <= 1) {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        uint64_t maxProduct = uint64_t(modulo - 1) * (modulo - 1);
+
+        // Keep room for the already reduced remainder (< modulo) carried between two reductions
+        uint64_t interval = (std::numeric_limits<uint64_t>::max() - modulo) / maxProduct;
+        return interval > 0 ? interval : 1;
+    }
+
+    /**
+     * @brief Computes the dot product of two arrays of reduced values modulo n.
+     * The products are summed in 8 independent 64 bits lanes, that the compiler maps to SIMD registers, and the lanes
+     * are only reduced when they could overflow (see reductionInterval).
+     * @param lhs The left values.
+     * @param rhs The right values.
+     * @param count The number of values of each array.
+     * @param modulo The modulo.
+     * @return The sum of lhs[k] * rhs[k] modulo n.
+     */
+    static unsigned dot(const unsigned *lhs, const unsigned *rhs, std::size_t count, unsigned modulo) {
+        constexpr std::size_t LANES = 8;
+        const uint64_t interval = reductionInterval(modulo);
+        uint64_t total = 0;
+
+        std::size_t k = 0;
+        while (k < count) {
+            // Each lane receives at most interval products before being reduced
+            std::size_t end = count;
+            if ((count - k) / LANES >= interval) {
+                end = k + std::size_t(interval) * LANES;
+            }
+
+            uint64_t lanes[LANES] = {};
+            for (; k + LANES <= end; k += LANES) {
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    lanes[l] += uint64_t(lhs[k + l]) * rhs[k + l];
+                }
+            }
+            for (std::size_t l = 0; k < end; ++k, ++l) {
+                lanes[l] += uint64_t(lhs[k]) * rhs[k];
+            }
+
+            for (uint64_t lane: lanes) {
+                total = (total + lane % modulo) % modulo;
+            }
+        }
+        return unsigned(total);
+    }
+};
+
+#endif //LABMATRIX_MODULAR_H
@@ -0,0 +1,119 @@
+#ifndef LABMATRIX_MONTGOMERY_H
+#define LABMATRIX_MONTGOMERY_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class Montgomery
+ * @brief Helper class that multiplies values modulo an odd n in Montgomery form, without any division
+ * @authors Slimani Walid, Van Hove Timothée
+ * A value a is stored as a * 2^32 mod n. The product of two values in this form is brought back to this form by a
+ * Montgomery reduction, which only uses multiplications and shifts: it is much cheaper than the % of Modular when
+ * many products are chained, as in an exponentiation.
+ */
+class Montgomery {
+private:
+    // Number of values exponentiated together, so that the compiler maps them to SIMD lanes
+    static constexpr std::size_t LANES = 8;
+
+    uint32_t modulo;
+    // n^-1 mod 2^32
+    uint32_t inverse;
+    // 2^64 mod n, converts a value to the Montgomery form
+    uint32_t r2;
+
+public:
+    /**
+     * @brief Prepares the constants of the Montgomery form for a modulo.
+     * @param modulo The modulo, must be odd.
+     */
+    constexpr explicit Montgomery(uint32_t modulo) : modulo(modulo), inverse(modulo), r2(0) {
+        // Newton iterations, each one doubles the number of correct low bits (3 bits at first for an odd number)
+        for (int i = 0; i < 4; ++i) {
+            inverse *= 2 - modulo * inverse;
+        }
+        const uint64_t r = (uint64_t(1) << 32) % modulo;
+        r2 = uint32_t(r * r % modulo);
+    }
+
+    /**
+     * @brief Computes a * 2^-32 mod n.
+     * @param value The value, lower than n * 2^32.
+     * @return The reduced value, lower than n.
+     */
+    [[nodiscard]] constexpr uint32_t reduce(uint64_t value) const {
+        // The low halves of value and m * n are equal, so their difference is a multiple of 2^32 in (-n * 2^32, n * 2^32)
+        const uint32_t m = uint32_t(value) * inverse;
+        const uint64_t mn = uint64_t(m) * modulo;
+        const uint32_t high = uint32_t(value >> 32), mnHigh = uint32_t(mn >> 32);
+        return high >= mnHigh ? high - mnHigh : high - mnHigh + modulo;
+    }
+
+    /**
+     * @brief Multiplies two values in Montgomery form.
+     * @param n The left value.
+     * @param m The right value.
+     * @return The product in Montgomery form.
+     */
+    [[nodiscard]] constexpr uint32_t multiply(uint32_t n, uint32_t m) const {
+        return reduce(uint64_t(n) * m);
+    }
+
+    /**
+     * @brief Converts a reduced value to the Montgomery form.
+     * @param value The value, lower than n.
+     * @return The value in Montgomery form.
+     */
+    [[nodiscard]] constexpr uint32_t toMontgomery(uint32_t value) const { return multiply(value, r2); }
+
+    /**
+     * @brief Converts a value in Montgomery form back to a reduced value.
+     * @param value The value in Montgomery form.
+     * @return The reduced value.
+     */
+    [[nodiscard]] constexpr uint32_t fromMontgomery(uint32_t value) const { return reduce(value); }
+
+    /**
+     * @brief Raises reduced values to the same power, by square-and-multiply.
+     * The values are processed by groups of LANES that follow the same sequence of operations, so the loops over a
+     * group are vectorized.
+     * @param source The values, lower than n.
+     * @param destination Where the powers are written, may be the source itself.
+     * @param count The number of values.
+     * @param exponent The power, 0^0 is 1.
+     */
+    void pow(const unsigned *source, unsigned *destination, std::size_t count, uint64_t exponent) const {
+        const uint32_t one = toMontgomery(1 % modulo);
+        for (std::size_t first = 0; first < count; first += LANES) {
+            const std::size_t lanes = count - first < LANES ? count - first : LANES;
+            uint32_t base[LANES] = {}, result[LANES];
+            for (std::size_t l = 0; l < lanes; ++l) {
+                base[l] = toMontgomery(source[first + l]);
+            }
+            for (uint32_t &lane: result) {
+                lane = one;
+            }
+
+            // Right to left: the bits of the exponent select the squares of the base to multiply
+            for (uint64_t e = exponent; e != 0; e >>= 1) {
+                if (e & 1u) {
+                    for (std::size_t l = 0; l < LANES; ++l) {
+                        result[l] = multiply(result[l], base[l]);
+                    }
+                }
+                if (e > 1) {
+                    for (std::size_t l = 0; l < LANES; ++l) {
+                        base[l] = multiply(base[l], base[l]);
+                    }
+                }
+            }
+
+            for (std::size_t l = 0; l < lanes; ++l) {
+                destination[first + l] = fromMontgomery(result[l]);
+            }
+        }
+    }
+};
+
+#endif //LABMATRIX_MONTGOMERY_H
@@ -0,0 +1,258 @@
+#include "Parallel.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+    // Whether the parallel loops of this thread run on it, see Parallel::Sequential
+    thread_local bool sequential = false;
+
+#ifdef __linux__
+    /**
+     * @brief Pins the calling thread on one of the allowed CPUs.
+     * @param allowed The CPUs allowed to the thread starting the parallel loop.
+     * @param index The index of the CPU among the allowed ones, modulo their number.
+     */
+    void pinThread(const cpu_set_t &allowed, std::size_t index) {
+        const auto count = std::size_t(CPU_COUNT(&allowed));
+        if (count == 0) {
+            return;
+        }
+        index %= count;
+        for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &allowed) && index-- == 0) {
+                cpu_set_t single;
+                CPU_ZERO(&single);
+                CPU_SET(cpu, &single);
+                // An error leaves the thread where the scheduler put it
+                pthread_setaffinity_np(pthread_self(), sizeof(single), &single);
+                return;
+            }
+        }
+    }
+#endif
+
+    /** @brief A parallel loop, on the stack of its calling thread until all its chunks are done. */
+    struct Loop {
+        const std::function<void(std::size_t, std::size_t)> &body;
+        std::size_t begin, chunkSize, remainder;
+        bool pinned;
+#ifdef __linux__
+        // The CPUs allowed to the calling thread, the chunks are pinned among them and restored to them
+        cpu_set_t allowed;
+#endif
+        std::vector<std::exception_ptr> errors;
+        std::size_t remaining;
+        std::mutex mutex;
+        std::condition_variable done;
+
+        Loop(const std::function<void(std::size_t, std::size_t)> &body, std::size_t begin, std::size_t end,
+             std::size_t chunks)
+                : body(body), begin(begin), chunkSize((end - begin) / chunks), remainder((end - begin) % chunks),
+                  pinned(Parallel::getPinning()), errors(chunks), remaining(chunks) {
+#ifdef __linux__
+            CPU_ZERO(&allowed);
+            if (pinned) {
+                pthread_getaffinity_np(pthread_self(), sizeof(allowed), &allowed);
+            }
+#endif
+        }
+
+        /** @return The first index of a chunk, the remainder is spread over the first chunks. */
+        std::size_t chunkBegin(std::size_t chunk) const {
+            return begin + chunk * chunkSize + std::min(chunk, remainder);
+        }
+
+        /**
+         * @brief Processes a chunk on the calling thread, which then counts it as done.
+         * @param chunk The index of the chunk.
+         */
+        void run(std::size_t chunk) {
+#ifdef __linux__
+            if (pinned) {
+                pinThread(allowed, chunk);
+            }
+#endif
+            try {
+                Parallel::Sequential nested;
+                body(chunkBegin(chunk), chunkBegin(chunk + 1));
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+#ifdef __linux__
+            if (pinned) {
+                pthread_setaffinity_np(pthread_self(), sizeof(allowed), &allowed);
+            }
+#endif
+            // Notified under the lock, the calling thread cannot destroy the loop before it is released
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--remaining == 0) {
+                done.notify_one();
+            }
+        }
+    };
+
+    /** @brief The threads running the chunks of the parallel loops, started when a loop needs them. */
+    class Pool {
+    private:
+        struct Task {
+            Loop *loop;
+            std::size_t chunk;
+        };
+
+        std::vector<std::thread> workers;
+        std::deque<Task> tasks;
+        std::mutex mutex;
+        std::condition_variable taskAvailable;
+        bool stopping = false;
+
+        void work() {
+            Parallel::Sequential nested;
+            for (;;) {
+                Task task{};
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+                    if (tasks.empty()) {
+                        return;
+                    }
+                    task = tasks.front();
+                    tasks.pop_front();
+                }
+                task.loop->run(task.chunk);
+            }
+        }
+
+    public:
+        ~Pool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            taskAvailable.notify_all();
+            for (std::thread &worker: workers) {
+                worker.join();
+            }
+        }
+
+        /**
+         * @brief Queues the chunks of a loop after the first one, starting threads until there is one per chunk. A
+         * thread that cannot be started leaves its chunks to the calling thread.
+         * @param loop The loop.
+         * @param chunks The number of chunks of the loop.
+         */
+        void post(Loop &loop, std::size_t chunks) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                try {
+                    while (workers.size() < chunks - 1) {
+                        workers.emplace_back(&Pool::work, this);
+                    }
+                } catch (const std::system_error &) {
+                }
+                for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+                    tasks.push_back({&loop, chunk});
+                }
+            }
+            taskAvailable.notify_all();
+        }
+
+        /**
+         * @brief Takes back a chunk of a loop that no thread has started.
+         * @param loop The loop.
+         * @param chunk Receives the index of the chunk.
+         * @return Whether a chunk was taken.
+         */
+        bool take(const Loop &loop, std::size_t &chunk) {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto task = std::find_if(tasks.begin(), tasks.end(),
+                                           [&loop](const Task &queued) { return queued.loop == &loop; });
+            if (task == tasks.end()) {
+                return false;
+            }
+            chunk = task->chunk;
+            tasks.erase(task);
+            return true;
+        }
+
+        /** @return The pool shared by the parallel loops, created on first use and joined at exit. */
+        static Pool &shared() {
+            static Pool pool;
+            return pool;
+        }
+    };
+}
+
+std::atomic<unsigned> Parallel::threadCount{0};
+std::atomic<bool> Parallel::pinning{false};
+
+Parallel::Sequential::Sequential() : previous(sequential) {
+    sequential = true;
+}
+
+Parallel::Sequential::~Sequential() {
+    sequential = previous;
+}
+
+unsigned Parallel::getThreadCount() {
+    unsigned count = threadCount.load(std::memory_order_relaxed);
+    if (count == 0) {
+        count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return count;
+}
+
+void Parallel::setThreadCount(unsigned count) {
+    threadCount.store(count, std::memory_order_relaxed);
+}
+
+bool Parallel::getPinning() {
+    return pinning.load(std::memory_order_relaxed);
+}
+
+void Parallel::setPinning(bool enabled) {
+    pinning.store(enabled, std::memory_order_relaxed);
+}
+
+void Parallel::forRange(std::size_t begin, std::size_t end, std::size_t grain,
+                        const std::function<void(std::size_t, std::size_t)> &body) {
+    if (end <= begin) {
+        return;
+    }
+
+    const std::size_t size = end - begin;
+    const std::size_t chunks = std::min<std::size_t>(getThreadCount(), size / std::max<std::size_t>(grain, 1));
+    if (chunks <= 1 || sequential) {
+        body(begin, end);
+        return;
+    }
+
+    // The loop stays on this stack until its last chunk is done, wherever it runs
+    Loop loop(body, begin, end, chunks);
+    Pool &pool = Pool::shared();
+    pool.post(loop, chunks);
+    loop.run(0);
+    for (std::size_t chunk; pool.take(loop, chunk);) {
+        loop.run(chunk);
+    }
+    {
+        std::unique_lock<std::mutex> lock(loop.mutex);
+        loop.done.wait(lock, [&loop] { return loop.remaining == 0; });
+    }
+
+    for (const std::exception_ptr &error: loop.errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
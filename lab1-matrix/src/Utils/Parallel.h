@@ -0,0 +1,80 @@
+#ifndef LABMATRIX_PARALLEL_H
+#define LABMATRIX_PARALLEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+/**
+ * @class Parallel
+ * @brief Helper class that splits the work of the matrix kernels across threads
+ * @authors Slimani Walid, Van Hove Timothée
+ * The chunks run on a pool of threads started on first use and kept until exit, grown up to the thread count. A loop
+ * started from a chunk, or from a thread of an Executor, runs on its calling thread.
+ */
+class Parallel {
+private:
+    static std::atomic<unsigned> threadCount;
+    static std::atomic<bool> pinning;
+
+public:
+    /**
+     * @brief Runs the parallel loops started by the current thread on that thread, as long as it is alive. The threads
+     * already running concurrently (the chunks of a loop, the Executor threads) use it so that a nested loop does
+     * not multiply the threads.
+     */
+    class Sequential {
+    private:
+        bool previous;
+
+    public:
+        Sequential();
+
+        ~Sequential();
+
+        Sequential(const Sequential &) = delete;
+
+        Sequential &operator=(const Sequential &) = delete;
+    };
+
+    /**
+     * @brief Gets the maximum number of threads used by a parallel loop.
+     * @return The number of threads, the number of hardware threads unless changed with setThreadCount.
+     */
+    static unsigned getThreadCount();
+
+    /**
+     * @brief Sets the maximum number of threads used by a parallel loop.
+     * @param count The number of threads, 0 to use the number of hardware threads.
+     */
+    static void setThreadCount(unsigned count);
+
+    /** @return true if the chunks of a parallel loop run on pinned CPUs, false otherwise. */
+    static bool getPinning();
+
+    /**
+     * @brief Pins the threads of the parallel loops, chunk k on the k-th CPU allowed to the calling
+     * thread. A range split with
+     * the same grain always gives its k-th chunk to the same CPU, so the pages placed by a first touch of a chunk stay
+     * local to the thread that later processes it. The calling thread is pinned for the first chunk, then restored.
+     * Without pinning, the scheduler places the threads and the first touch placement is only best-effort.
+     * @note Only implemented on Linux, elsewhere the threads are never pinned.
+     * @param enabled true to pin the threads, false to let the scheduler place them.
+     */
+    static void setPinning(bool enabled);
+
+    /**
+     * @brief Splits a range of indices in contiguous chunks and processes them concurrently.
+     * The calling thread processes the first chunk, and the chunks no thread of the pool has started yet. The range is
+     * not split if it is smaller than two grains, or if the calling thread is Sequential.
+     * @param begin The first index of the range.
+     * @param end The index after the last index of the range.
+     * @param grain The minimum number of indices given to a thread, to keep the threads worth their cost.
+     * @param body The function processing the sub-range [first, last), called once per chunk.
+     * @throws Rethrows the first exception thrown by body, once all the threads are joined.
+     */
+    static void forRange(std::size_t begin, std::size_t end, std::size_t grain,
+                         const std::function<void(std::size_t, std::size_t)> &body);
+};
+
+#endif //LABMATRIX_PARALLEL_H
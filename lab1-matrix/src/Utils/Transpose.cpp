@@ -0,0 +1,114 @@
+#include "Transpose.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LABMATRIX_TRANSPOSE_SSE2
+#endif
+
+void Transpose::micro(const unsigned *source, std::size_t sourceStride, unsigned *destination,
+                      std::size_t destinationStride) {
+#ifdef LABMATRIX_TRANSPOSE_SSE2
+    // Four 4x4 transposes, the block (I, J) of the source becomes the block (J, I) of the destination
+    for (unsigned blockRow = 0; blockRow < MICRO; blockRow += 4) {
+        for (unsigned blockColumn = 0; blockColumn < MICRO; blockColumn += 4) {
+            const unsigned *from = source + blockRow * sourceStride + blockColumn;
+            unsigned *to = destination + blockColumn * destinationStride + blockRow;
+
+            const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from));
+            const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + sourceStride));
+            const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 2 * sourceStride));
+            const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 3 * sourceStride));
+
+            // Interleave the 32 bits lanes, then the 64 bits lanes
+            const __m128i t0 = _mm_unpacklo_epi32(r0, r1), t1 = _mm_unpacklo_epi32(r2, r3);
+            const __m128i t2 = _mm_unpackhi_epi32(r0, r1), t3 = _mm_unpackhi_epi32(r2, r3);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(to), _mm_unpacklo_epi64(t0, t1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(to + destinationStride), _mm_unpackhi_epi64(t0, t1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(to + 2 * destinationStride), _mm_unpacklo_epi64(t2, t3));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(to + 3 * destinationStride), _mm_unpackhi_epi64(t2, t3));
+        }
+    }
+#else
+    // Fixed size loops, unrolled and vectorized by the compiler
+    unsigned block[MICRO][MICRO];
+    for (unsigned i = 0; i < MICRO; ++i) {
+        for (unsigned j = 0; j < MICRO; ++j) {
+            block[j][i] = source[i * sourceStride + j];
+        }
+    }
+    for (unsigned i = 0; i < MICRO; ++i) {
+        std::copy(block[i], block[i] + MICRO, destination + i * destinationStride);
+    }
+#endif
+}
+
+void Transpose::copy(const unsigned *source, std::size_t sourceStride, unsigned *destination,
+                     std::size_t destinationStride, unsigned rows, unsigned columns) {
+    if (rows == MICRO && columns == MICRO) {
+        micro(source, sourceStride, destination, destinationStride);
+    } else if (rows <= MICRO && columns <= MICRO) {
+        for (unsigned i = 0; i < rows; ++i) {
+            for (unsigned j = 0; j < columns; ++j) {
+                destination[j * destinationStride + i] = source[i * sourceStride + j];
+            }
+        }
+    } else if (rows >= columns) {
+        const unsigned half = split(rows);
+        copy(source, sourceStride, destination, destinationStride, half, columns);
+        copy(source + half * sourceStride, sourceStride, destination + half, destinationStride, rows - half, columns);
+    } else {
+        const unsigned half = split(columns);
+        copy(source, sourceStride, destination, destinationStride, rows, half);
+        copy(source + half, sourceStride, destination + half * destinationStride, destinationStride, rows,
+             columns - half);
+    }
+}
+
+void Transpose::swap(unsigned *a, unsigned *b, std::size_t stride, unsigned rows, unsigned columns) {
+    if (rows == MICRO && columns == MICRO) {
+        unsigned block[MICRO * MICRO];
+        micro(a, stride, block, MICRO);
+        micro(b, stride, a, stride);
+        for (unsigned i = 0; i < MICRO; ++i) {
+            std::copy(block + i * MICRO, block + (i + 1) * MICRO, b + i * stride);
+        }
+    } else if (rows <= MICRO && columns <= MICRO) {
+        for (unsigned i = 0; i < rows; ++i) {
+            for (unsigned j = 0; j < columns; ++j) {
+                std::swap(a[i * stride + j], b[j * stride + i]);
+            }
+        }
+    } else if (rows >= columns) {
+        const unsigned half = split(rows);
+        swap(a, b, stride, half, columns);
+        swap(a + half * stride, b + half, stride, rows - half, columns);
+    } else {
+        const unsigned half = split(columns);
+        swap(a, b, stride, rows, half);
+        swap(a + half, b + half * stride, stride, rows, columns - half);
+    }
+}
+
+void Transpose::square(unsigned *data, std::size_t stride, unsigned size) {
+    if (size == MICRO) {
+        unsigned block[MICRO * MICRO];
+        micro(data, stride, block, MICRO);
+        for (unsigned i = 0; i < MICRO; ++i) {
+            std::copy(block + i * MICRO, block + (i + 1) * MICRO, data + i * stride);
+        }
+    } else if (size < MICRO) {
+        for (unsigned i = 0; i < size; ++i) {
+            for (unsigned j = i + 1; j < size; ++j) {
+                std::swap(data[i * stride + j], data[j * stride + i]);
+            }
+        }
+    } else {
+        // Transpose the 2 diagonal blocks in-place and exchange the 2 other ones
+        const unsigned half = split(size);
+        square(data, stride, half);
+        square(data + half * stride + half, stride, size - half);
+        swap(data + half, data + half * stride, stride, half, size - half);
+    }
+}
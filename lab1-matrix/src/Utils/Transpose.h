@@ -0,0 +1,69 @@
+#ifndef LABMATRIX_TRANSPOSE_H
+#define LABMATRIX_TRANSPOSE_H
+
+#include <cstddef>
+
+/**
+ * @class Transpose
+ * @brief Helper class that contains the cache-oblivious transpose kernels used within the matrix classes
+ * @authors Slimani Walid, Van Hove Timothée
+ * The blocks are split in two along their largest dimension until they are at most MICRO x MICRO, so every level of
+ * cache ends up holding both the source and the destination of a sub-block whatever its size. The 8x8 blocks are
+ * transposed in registers (SSE2 when available).
+ */
+class Transpose {
+private:
+    // Side of the blocks transposed in registers
+    static constexpr unsigned MICRO = 8;
+
+    /**
+     * @brief Gets where a dimension is split, a multiple of MICRO so that the sub-blocks stay aligned on the micro
+     * blocks.
+     * @param size The dimension, greater than MICRO.
+     * @return The size of the first half, in (0, size).
+     */
+    static unsigned split(unsigned size) { return (size / 2 + MICRO - 1) / MICRO * MICRO; }
+
+    /**
+     * @brief Transposes a 8x8 block.
+     * @param source The first element of the block.
+     * @param sourceStride The distance between two rows of the source.
+     * @param destination The first element of the transposed block, must not overlap the source.
+     * @param destinationStride The distance between two rows of the destination.
+     */
+    static void micro(const unsigned *source, std::size_t sourceStride, unsigned *destination,
+                      std::size_t destinationStride);
+
+    /**
+     * @brief Exchanges a block with the transpose of another block of the same matrix: A = B^T and B = A^T.
+     * @param a The first element of the block A.
+     * @param b The first element of the block B, the blocks must not overlap.
+     * @param stride The distance between two rows.
+     * @param rows The number of rows of A, the number of columns of B.
+     * @param columns The number of columns of A, the number of rows of B.
+     */
+    static void swap(unsigned *a, unsigned *b, std::size_t stride, unsigned rows, unsigned columns);
+
+public:
+    /**
+     * @brief Writes the transpose of a block to another block.
+     * @param source The first element of the block.
+     * @param sourceStride The distance between two rows of the source.
+     * @param destination The first element of the transposed block, must not overlap the source.
+     * @param destinationStride The distance between two rows of the destination.
+     * @param rows The number of rows of the source.
+     * @param columns The number of columns of the source.
+     */
+    static void copy(const unsigned *source, std::size_t sourceStride, unsigned *destination,
+                     std::size_t destinationStride, unsigned rows, unsigned columns);
+
+    /**
+     * @brief Transposes a square block in-place.
+     * @param data The first element of the block.
+     * @param stride The distance between two rows.
+     * @param size The number of rows and columns of the block.
+     */
+    static void square(unsigned *data, std::size_t stride, unsigned size);
+};
+
+#endif //LABMATRIX_TRANSPOSE_H
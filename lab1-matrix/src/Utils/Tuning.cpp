@@ -0,0 +1,176 @@
+#include "Tuning.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "Parallel.h"
+#include "../Matrix/Matrix.hpp"
+
+namespace {
+    // Default minimum work of a thread, in elements or multiply-adds
+    constexpr std::size_t DEFAULT_GRAIN = std::size_t(1) << 16;
+
+    // Candidates would rather beat the current value by this factor, the measures of equal values are noisy
+    constexpr double MIN_GAIN = 0.95;
+
+    // A modulo below 2^16, for which the element-wise kernels take their 32 bits path like most matrices
+    constexpr unsigned TUNING_MODULO = 65521;
+}
+
+std::atomic<std::size_t> Tuning::elementGrainValue{DEFAULT_GRAIN};
+std::atomic<std::size_t> Tuning::productGrainValue{DEFAULT_GRAIN};
+std::atomic<unsigned> Tuning::productBlockValue{0};
+
+Tuning::Profile Tuning::defaultProfile() {
+    return {0, DEFAULT_GRAIN, DEFAULT_GRAIN, 0};
+}
+
+Tuning::Profile Tuning::getProfile() {
+    return {Parallel::getThreadCount(), elementGrain(), productGrain(), productBlock()};
+}
+
+void Tuning::setProfile(const Profile &profile) {
+    Parallel::setThreadCount(profile.threadCount);
+    elementGrainValue.store(std::max<std::size_t>(1, profile.elementGrain), std::memory_order_relaxed);
+    productGrainValue.store(std::max<std::size_t>(1, profile.productGrain), std::memory_order_relaxed);
+    productBlockValue.store(profile.productBlock, std::memory_order_relaxed);
+}
+
+std::string Tuning::cpuModel() {
+    std::ifstream cpuInfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuInfo, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            const std::size_t start = line.find_first_not_of(" \t", line.find(':') + 1);
+            if (start != std::string::npos) {
+                return line.substr(start);
+            }
+        }
+    }
+    return "unknown";
+}
+
+std::string Tuning::profileKey() {
+    return cpuModel() + " x" + std::to_string(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+double Tuning::measure(const std::function<void()> &kernel) {
+    kernel();
+    double best = 0;
+    for (int run = 0; run < 3; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        kernel();
+        const double duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = run == 0 ? duration : std::min(best, duration);
+    }
+    return best;
+}
+
+Tuning::Profile Tuning::autotune() {
+    Profile profile = defaultProfile();
+    setProfile(profile);
+
+    // The values of the elements do not change the speed of the kernels, the matrices are not randomized
+    Matrix large = Matrix::zeros(1024, 512, TUNING_MODULO), small = Matrix::zeros(256, 256, TUNING_MODULO);
+    const Matrix left = Matrix::zeros(48, 256, TUNING_MODULO), right = Matrix::zeros(256, 2048, TUNING_MODULO);
+    const Matrix square = Matrix::zeros(64, 64, TUNING_MODULO);
+    auto elementWise = [&] { large.axpy(3, large); };
+    auto smallElementWise = [&] { small.axpy(3, small); };
+    auto product = [&] { (void) left.product(right); };
+    auto smallProduct = [&] { (void) square.product(square); };
+
+    // Tries the candidates of a parameter in order, the first one being the current value
+    auto tune = [&profile](auto &parameter, const auto &candidates, const std::function<double()> &run) {
+        double bestTime = 0;
+        auto bestValue = parameter;
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            parameter = candidates[i];
+            setProfile(profile);
+            const double time = run();
+            if (i == 0 || time < bestTime * MIN_GAIN) {
+                bestTime = time;
+                bestValue = candidates[i];
+            }
+        }
+        parameter = bestValue;
+        setProfile(profile);
+    };
+
+    // 0 keeps all the hardware threads, the profile then follows a machine with more of them
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threads{0};
+    for (unsigned count = 1; count < hardware; count *= 2) {
+        threads.push_back(count);
+    }
+    tune(profile.threadCount, threads, [&] { return measure(elementWise) + measure(product); });
+
+    const std::vector<std::size_t> grains{DEFAULT_GRAIN, DEFAULT_GRAIN / 16, DEFAULT_GRAIN / 4, DEFAULT_GRAIN * 4,
+                                          DEFAULT_GRAIN * 16};
+    tune(profile.elementGrain, grains, [&] { return measure(smallElementWise); });
+    tune(profile.productGrain, grains, [&] { return measure(smallProduct); });
+
+    const std::vector<unsigned> blocks{0, 64, 256, 1024};
+    tune(profile.productBlock, blocks, [&] { return measure(product); });
+    return profile;
+}
+
+bool Tuning::loadProfile(const std::string &path) {
+    std::ifstream file(path);
+    const std::string model = profileKey();
+    std::string line;
+    while (std::getline(file, line)) {
+        // <CPU model> x<hardware threads> TAB <threads> <element grain> <product grain> <product block>
+        const std::size_t separator = line.rfind('\t');
+        if (separator == std::string::npos || line.compare(0, separator, model) != 0 || separator != model.size()) {
+            continue;
+        }
+
+        std::istringstream values(line.substr(separator + 1));
+        Profile profile{};
+        if (values >> profile.threadCount >> profile.elementGrain >> profile.productGrain >> profile.productBlock &&
+            profile.elementGrain > 0 && profile.productGrain > 0) {
+            setProfile(profile);
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+void Tuning::saveProfile(const std::string &path, const Profile &profile) {
+    const std::string model = profileKey();
+
+    // Keep the profiles of the other models
+    std::vector<std::string> lines;
+    std::ifstream existing(path);
+    std::string line;
+    while (std::getline(existing, line)) {
+        if (!line.empty() && line.rfind(model + '\t', 0) != 0) {
+            lines.push_back(line);
+        }
+    }
+    existing.close();
+
+    std::ostringstream entry;
+    entry << model << '\t' << profile.threadCount << ' ' << profile.elementGrain << ' ' << profile.productGrain << ' '
+          << profile.productBlock;
+    lines.push_back(entry.str());
+
+    std::ofstream file(path, std::ios::trunc);
+    for (const std::string &text: lines) {
+        file << text << '\n';
+    }
+    if (!file) {
+        throw std::runtime_error("The tuning profile cannot be written to " + path);
+    }
+}
+
+Tuning::Profile Tuning::initialize(const std::string &path) {
+    if (!loadProfile(path)) {
+        saveProfile(path, autotune());
+    }
+    return getProfile();
+}
@@ -0,0 +1,104 @@
+#ifndef LABMATRIX_TUNING_H
+#define LABMATRIX_TUNING_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/**
+ * @class Tuning
+ * @brief Helper class that holds the parameters of the Matrix kernels and finds their best values for the machine
+ * @authors Slimani Walid, Van Hove Timothée
+ * The parameters are the number of threads, the minimum work given to a thread by the element-wise kernels and by the
+ * products, and the number of columns of the result computed together by the product kernel. The grains also apply to
+ * the kernels of the other representations (tiled, band, RNS) and of the LU decomposition. autotune() measures
+ * candidate values of each parameter on this machine, and the winners are saved to a profile file with one line per
+ * CPU model and number of hardware threads, so that initialize() only has to read them on the next runs.
+ */
+class Tuning {
+public:
+    /** @brief The values of the tuned parameters. */
+    struct Profile {
+        unsigned threadCount;     // Maximum number of threads of a parallel loop, 0 for the hardware threads
+        std::size_t elementGrain; // Minimum number of elements processed by a thread in the element-wise kernels
+        std::size_t productGrain; // Minimum number of multiply-adds processed by a thread in the products
+        unsigned productBlock;    // Number of columns of the result accumulated together by a product, 0 for all
+    };
+
+private:
+    static std::atomic<std::size_t> elementGrainValue, productGrainValue;
+    static std::atomic<unsigned> productBlockValue;
+
+    /**
+     * @brief Measures the duration of a kernel, the best of a few runs after a warm-up run.
+     * @param kernel The kernel to run.
+     * @return The duration in seconds.
+     */
+    static double measure(const std::function<void()> &kernel);
+
+public:
+    /** @return The parameters used when no profile is loaded. */
+    static Profile defaultProfile();
+
+    /** @return The parameters currently used by the kernels. */
+    static Profile getProfile();
+
+    /**
+     * @brief Sets the parameters used by the kernels, the number of threads is given to Parallel.
+     * @param profile The parameters, the grains are at least 1.
+     */
+    static void setProfile(const Profile &profile);
+
+    /** @return The minimum number of elements processed by a thread in the element-wise kernels. */
+    static std::size_t elementGrain() { return elementGrainValue.load(std::memory_order_relaxed); }
+
+    /** @return The minimum number of multiply-adds processed by a thread in the products. */
+    static std::size_t productGrain() { return productGrainValue.load(std::memory_order_relaxed); }
+
+    /** @return The number of columns of the result accumulated together by a product, 0 for the whole row. */
+    static unsigned productBlock() { return productBlockValue.load(std::memory_order_relaxed); }
+
+    /** @return The model name of the CPU, "unknown" if it cannot be read. */
+    static std::string cpuModel();
+
+    /**
+     * @return The key of the profiles, the model name of the CPU and the number of hardware threads: the same model
+     * name is often reported by virtual machines of any size.
+     */
+    static std::string profileKey();
+
+    /**
+     * @brief Measures candidate values of each parameter with the Matrix kernels, one parameter after the other, and
+     * uses the fastest ones. It takes about a second.
+     * @return The parameters found, now used by the kernels.
+     */
+    static Profile autotune();
+
+    /**
+     * @brief Reads the profile of this CPU model from a profile file and uses it.
+     * @param path The profile file.
+     * @return Whether the file holds a valid profile for this CPU model.
+     */
+    static bool loadProfile(const std::string &path);
+
+    /**
+     * @brief Writes a profile for this CPU model to a profile file, replacing the previous one and keeping the
+     * profiles of the other models.
+     * @param path The profile file, created if it does not exist.
+     * @param profile The parameters to save.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    static void saveProfile(const std::string &path, const Profile &profile);
+
+    /**
+     * @brief Uses the profile of this CPU model saved in a profile file, or finds it with autotune() and saves it when
+     * there is none.
+     * @param path The profile file.
+     * @return The parameters now used by the kernels.
+     * @throws std::runtime_error if a new profile cannot be written.
+     */
+    static Profile initialize(const std::string &path);
+};
+
+#endif //LABMATRIX_TUNING_H
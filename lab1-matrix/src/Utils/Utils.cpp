@@ -1,8 +1,45 @@
 #include "Utils.h"
+#include <atomic>
+#include <mutex>
+
+namespace {
+    // Generator shared by the threads once seeded, a fresh one is seeded by std::random_device otherwise
+    std::atomic<bool> seeded{false};
+    std::mutex seededMutex;
+    std::mt19937 seededGenerator;
+}
 
 unsigned Utils::getRandom(unsigned upperBound) {
+    std::uniform_int_distribution<unsigned> distrib(0, upperBound - 1);
+    if (seeded.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(seededMutex);
+        return distrib(seededGenerator);
+    }
+
     static std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<unsigned> distrib(0, upperBound - 1);
     return distrib(gen);
 }
+
+uint64_t Utils::getRandomSeed() {
+    if (seeded.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(seededMutex);
+        const uint64_t high = seededGenerator();
+        return high << 32 | seededGenerator();
+    }
+
+    static std::random_device rd;
+    const uint64_t high = rd();
+    return high << 32 | rd();
+}
+
+void Utils::setSeed(unsigned seed) {
+    std::lock_guard<std::mutex> lock(seededMutex);
+    seededGenerator.seed(seed);
+    seeded.store(true, std::memory_order_release);
+}
+
+void Utils::clearSeed() {
+    std::lock_guard<std::mutex> lock(seededMutex);
+    seeded.store(false, std::memory_order_release);
+}
@@ -1,6 +1,7 @@
 #ifndef LABMATRIX_UTILS_H
 #define LABMATRIX_UTILS_H
 
+#include <cstdint>
 #include <random>
 
 /**
@@ -17,6 +18,38 @@ public:
      * @return a random generated unsigned number
      */
     static unsigned getRandom(unsigned upperBound);
+
+    /**
+     * Returns the seed of a stream of random numbers, drawn from the seeded generator like getRandom once seeded
+     * @return a random generated seed for getRandom(seed, index, upperBound)
+     */
+    static uint64_t getRandomSeed();
+
+    /**
+     * Returns the random number at a position of a stream. It has no state (the finalizer of SplitMix64 applied to
+     * the position), so the parts of a stream can be drawn by different threads and still give the same numbers
+     * @param seed the seed of the stream, from getRandomSeed
+     * @param index the position of the number in the stream
+     * @param upperBound the upper bound of the distribution used to generate the number
+     * @return a random generated unsigned number
+     */
+    static unsigned getRandom(uint64_t seed, uint64_t index, unsigned upperBound) {
+        uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15u;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+        return unsigned((z ^ (z >> 31)) % upperBound);
+    }
+
+    /**
+     * Seeds the generator used by getRandom, which then gives the same sequence on every run
+     * @param seed the seed of the generator
+     */
+    static void setSeed(unsigned seed);
+
+    /**
+     * Returns getRandom to unseeded values, drawn from a generator seeded by std::random_device
+     */
+    static void clearSeed();
 };
 
 #endif //LABMATRIX_UTILS_H
@@ -0,0 +1,119 @@
+#include "Vector.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include "../Utils/Modular.h"
+#include "../Utils/Utils.h"
+
+// region Constructors
+
+Vector::Vector(unsigned size, unsigned modulo) : Vector(std::vector<unsigned>(size), modulo) {
+    for (unsigned &element: elements) {
+        element = Utils::getRandom(modulo);
+    }
+}
+
+Vector::Vector(const std::vector<unsigned> &values, unsigned modulo) : elements(values), modulo(modulo) {
+    if (modulo < 1) {
+        throw std::invalid_argument("modulo cannot be zero or less");
+    }
+
+    if (elements.empty()) {
+        throw std::runtime_error("size cannot be less than 1");
+    }
+
+    for (unsigned &element: elements) {
+        element %= modulo;
+    }
+}
+
+Vector Vector::zeros(unsigned size, unsigned modulo) {
+    return {std::vector<unsigned>(size, 0), modulo};
+}
+// endregion
+
+// region Public Methods
+
+unsigned Vector::get(unsigned index) const {
+    if (index >= elements.size()) {
+        throw std::out_of_range("The index is outside the vector");
+    }
+    return elements[index];
+}
+
+void Vector::set(unsigned index, unsigned value) {
+    if (index >= elements.size()) {
+        throw std::out_of_range("The index is outside the vector");
+    }
+    elements[index] = value % modulo;
+}
+
+Vector &Vector::add(const Vector &other) {
+    checkModulo(other.modulo);
+    if (other.elements.size() > elements.size()) {
+        elements.resize(other.elements.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.elements.size(); ++i) {
+        elements[i] = Modular::add(elements[i], other.elements[i], modulo);
+    }
+    return *this;
+}
+
+Vector Vector::addStatic(const Vector &other) const {
+    Vector result(*this);
+    result.add(other);
+    return result;
+}
+
+Vector &Vector::sub(const Vector &other) {
+    checkModulo(other.modulo);
+    if (other.elements.size() > elements.size()) {
+        elements.resize(other.elements.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.elements.size(); ++i) {
+        elements[i] = Modular::sub(elements[i], other.elements[i], modulo);
+    }
+    return *this;
+}
+
+Vector Vector::subStatic(const Vector &other) const {
+    Vector result(*this);
+    result.sub(other);
+    return result;
+}
+
+unsigned Vector::dot(const Vector &other) const {
+    checkModulo(other.modulo);
+
+    // The elements beyond the shorter vector are multiplied by 0
+    return Modular::dot(elements.data(), other.elements.data(), std::min(elements.size(), other.elements.size()),
+                        modulo);
+}
+// endregion
+
+// region Operators
+
+std::ostream &operator<<(std::ostream &os, const Vector &vector) {
+    for (unsigned element: vector.elements) {
+        os << element << " ";
+    }
+    os << std::endl;
+    return os;
+}
+
+Vector operator+(const Vector &lhs, const Vector &rhs) {
+    return lhs.addStatic(rhs);
+}
+
+Vector operator-(const Vector &lhs, const Vector &rhs) {
+    return lhs.subStatic(rhs);
+}
+// endregion
+
+// region Private Methods
+
+void Vector::checkModulo(unsigned otherModulo) const {
+    if (otherModulo != modulo) {
+        throw std::invalid_argument("The modulo of the 2 vectors must be identical");
+    }
+}
+// endregion
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+class Matrix;
+
+/**
+ * @class Vector
+ * @brief Represents a column vector with elements stored modulo n, the operand and result of the matrix-vector
+ * products of Matrix.
+ * @authors Slimani Walid, Van Hove Timothée
+ * The semantics are the same as Matrix: both operands must have the same modulo and a vector shorter than the other
+ * one is considered padded with zeros.
+ */
+class Vector {
+    friend class Matrix;
+
+private:
+    // region Fields
+    std::vector<unsigned> elements;
+    unsigned modulo;
+    // endregion
+
+    // region Private methods
+
+    /**
+     * @brief Checks that the modulo of another vector is the same as the one of this vector.
+     * @param otherModulo The modulo of the other vector.
+     * @throws std::invalid_argument if the moduli are different.
+     */
+    void checkModulo(unsigned otherModulo) const;
+
+    // endregion
+
+public:
+    // region Ctors
+    Vector() = delete;
+
+    /**
+    * @brief Constructs a Vector with random elements.
+    * @param size Number of elements of the vector.
+    * @param modulo The modulo value for vector operations.
+    * @throws std::invalid_argument if the modulo is 0.
+    * @throws std::runtime_error if the size is 0.
+    */
+    Vector(unsigned size, unsigned modulo);
+
+    /**
+    * @brief Constructs a Vector holding the given values.
+    * @param values The elements of the vector, reduced modulo n.
+    * @param modulo The modulo value for vector operations.
+    * @throws std::invalid_argument if the modulo is 0.
+    * @throws std::runtime_error if there is no value.
+    */
+    Vector(const std::vector<unsigned> &values, unsigned modulo);
+
+    /**
+     * @brief Creates a vector whose elements are all 0.
+     * @param size Number of elements of the vector.
+     * @param modulo The modulo value for vector operations.
+     * @return The zero vector.
+     */
+    static Vector zeros(unsigned size, unsigned modulo);
+    // endregion
+
+    // region Public methods
+
+    /** @return The number of elements of the vector. */
+    [[nodiscard]] unsigned getSize() const { return unsigned(elements.size()); }
+
+    /** @return The modulo applied to the elements of the vector. */
+    [[nodiscard]] unsigned getModulo() const { return modulo; }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param index The index of the element.
+     * @return The value of the element.
+     * @throws std::out_of_range if the index is outside the vector.
+     */
+    [[nodiscard]] unsigned get(unsigned index) const;
+
+    /**
+     * @brief Sets the value of an element.
+     * @param index The index of the element.
+     * @param value The value, reduced modulo n.
+     * @throws std::out_of_range if the index is outside the vector.
+     */
+    void set(unsigned index, unsigned value);
+
+    /**
+     * @brief Adds another vector to this vector in-place.
+     * @param other The vector to be added to this vector.
+     * @return A reference to this vector after the addition.
+     */
+    Vector &add(const Vector &other);
+
+    /**
+     * @brief Creates a new vector that is the result of adding another vector to this vector.
+     * @param other The vector to be added to this vector.
+     * @return A new Vector instance that is the result of the addition.
+     */
+    [[nodiscard]] Vector addStatic(const Vector &other) const;
+
+    /**
+     * @brief Subtracts another vector to this vector in-place.
+     * @param other The vector to be subtracted to this vector.
+     * @return A reference to this vector after the subtraction.
+     */
+    Vector &sub(const Vector &other);
+
+    /**
+     * @brief Creates a new vector that is the result of subtracting another vector to this vector.
+     * @param other The vector to be subtracted to this vector.
+     * @return A new Vector instance that is the result of the subtraction.
+     */
+    [[nodiscard]] Vector subStatic(const Vector &other) const;
+
+    /**
+     * @brief Computes the dot product of this vector with another one.
+     * @param other The other vector.
+     * @return The sum of the products of the elements modulo n.
+     * @throws std::invalid_argument if the moduli are different.
+     */
+    [[nodiscard]] unsigned dot(const Vector &other) const;
+
+    // endregion
+
+    // region Operators
+
+    /**
+    * @brief Stream insertion operator for Vector class, prints the elements on one line.
+    * @param os The output stream to insert into.
+    * @param vector The Vector object to insert into the stream.
+    * @return A reference to the modified output stream.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const Vector &vector);
+    // endregion
+};
+
+/**
+ * @brief Adds two vectors.
+ * @param lhs The left-hand side vector.
+ * @param rhs The right-hand side vector.
+ * @return A new vector that is the result of adding the two vectors.
+ */
+Vector operator+(const Vector &lhs, const Vector &rhs);
+
+/**
+ * @brief Subtracts two vectors.
+ * @param lhs The left-hand side vector.
+ * @param rhs The right-hand side vector.
+ * @return A new vector that is the result of subtracting the two vectors.
+ */
+Vector operator-(const Vector &lhs, const Vector &rhs);
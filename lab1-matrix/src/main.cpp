@@ -5,17 +5,59 @@
  */
 
 #include "Matrix/Matrix.hpp"
+#include "Utils/Parallel.h"
+#include "Utils/Tuning.h"
+#include "Utils/Utils.h"
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/** @brief An operation between the two matrices, selected with --ops. */
+struct Operation {
+    std::string name, label;
+    std::function<Matrix(const Matrix &, const Matrix &)> apply;
+};
+
+/** @brief The options following the dimensions and the modulus. */
+struct Options {
+    std::vector<Operation> operations;
+    unsigned long repeat = 1;
+    unsigned long threads = 0;
+    std::optional<unsigned long> seed;
+    bool quiet = false;
+};
 
 unsigned long parseArg(const char *arg);
+std::string tuningProfilePath();
+std::vector<Operation> parseOperations(const std::string &list);
+Options parseOptions(int argc, char *argv[]);
+std::string timingJson(const Operation &operation, std::vector<double> nanoseconds, const Matrix &one,
+                       const Matrix &two, const Matrix &result);
+long peakResidentKilobytes();
 
 int main(int argc, char *argv[]) {
     if (argc < 6) {
-        std::cerr << "Usage: " << argv[0] << " <N1> <M1> <N2> <M2> <modulus>\n";
+        std::cerr << "Usage: " << argv[0] << " <N1> <M1> <N2> <M2> <modulus> [options]\n"
+                  << "  --ops=<list>     operations among add, sub, multiply and product (default add,sub,multiply)\n"
+                  << "  (the values of the options can also follow them after a space: --ops <list>)\n"
+                  << "  --repeat=<count> number of runs of each operation (default 1)\n"
+                  << "  --threads=<count> number of threads of the kernels (default the tuning profile)\n"
+                  << "  --seed=<seed>    seed of the random matrices, for reproducible runs\n"
+                  << "  --quiet          print no matrix, only a JSON report of the timings\n";
         return EXIT_FAILURE;
     }
 
     unsigned long N1, M1, N2, M2, modulus;
+    Options options;
 
     try {
         N1 = parseArg(argv[1]);
@@ -23,27 +65,73 @@ int main(int argc, char *argv[]) {
         N2 = parseArg(argv[3]);
         M2 = parseArg(argv[4]);
         modulus = parseArg(argv[5]);
+        options = parseOptions(argc, argv);
     } catch (const std::runtime_error &e) {
         std::cerr << "Invalid argument: " << e.what() << "\n";
         return EXIT_FAILURE;
     }
 
-    std::cout << "The modulus is " << modulus << "\n\n";
+    // The kernel parameters of this machine are measured on the first run, then read from the profile file
+    const std::string profilePath = tuningProfilePath();
+    if (!profilePath.empty()) {
+        try {
+            Tuning::initialize(profilePath);
+        } catch (const std::runtime_error &e) {
+            std::cerr << "Warning: " << e.what() << "\n";
+        }
+    }
+    if (options.threads != 0) {
+        Parallel::setThreadCount((unsigned) options.threads);
+    }
+    if (options.seed) {
+        Utils::setSeed((unsigned) *options.seed);
+    }
 
+    using Clock = std::chrono::steady_clock;
+    const auto generationStart = Clock::now();
     Matrix one((unsigned) N1, (unsigned) M1, (unsigned) modulus);
     Matrix two((unsigned) N2, (unsigned) M2, (unsigned) modulus);
+    const std::chrono::duration<double, std::nano> generation = Clock::now() - generationStart;
 
-    std::cout << "one\n" << one << "\n";
-    std::cout << "two\n" << two << "\n";
+    if (!options.quiet) {
+        std::cout << "The modulus is " << modulus << "\n\n";
+        std::cout << "one\n" << one << "\n";
+        std::cout << "two\n" << two << "\n";
+    }
 
-    Matrix sum = one + two;
-    std::cout << "one + two\n" << sum << "\n";
+    std::vector<std::string> timings;
+    for (const Operation &operation: options.operations) {
+        std::vector<double> nanoseconds;
+        std::optional<Matrix> result;
+        try {
+            for (unsigned long run = 0; run < options.repeat; ++run) {
+                const auto start = Clock::now();
+                result.emplace(operation.apply(one, two));
+                nanoseconds.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+            }
+        } catch (const std::invalid_argument &e) {
+            std::cerr << operation.name << ": " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
 
-    Matrix difference = one - two;
-    std::cout << "one - two\n" << difference << "\n";
+        if (options.quiet) {
+            timings.push_back(timingJson(operation, nanoseconds, one, two, *result));
+        } else {
+            std::cout << operation.label << "\n" << *result << "\n";
+        }
+    }
 
-    Matrix product = one * two;
-    std::cout << "one x two\n" << product << "\n";
+    if (options.quiet) {
+        std::cout << "{\"lhs\": [" << N1 << ", " << M1 << "], \"rhs\": [" << N2 << ", " << M2 << "], "
+                  << "\"modulus\": " << modulus << ", \"threads\": " << Parallel::getThreadCount() << ", "
+                  << "\"repeat\": " << options.repeat << ", \"seed\": "
+                  << (options.seed ? std::to_string(*options.seed) : "null") << ", "
+                  << "\"generation_ns\": " << std::llround(generation.count()) << ", \"operations\": [";
+        for (std::size_t i = 0; i < timings.size(); ++i) {
+            std::cout << (i == 0 ? "" : ", ") << timings[i];
+        }
+        std::cout << "], \"peak_rss_kb\": " << peakResidentKilobytes() << "}\n";
+    }
 
     return EXIT_SUCCESS;
 }
@@ -63,3 +151,140 @@ unsigned long parseArg(const char *arg) {
     return value;
 }
 
+/**
+ * @brief Gets the path of the tuning profile file, $LABMATRIX_TUNING or ~/.labmatrix_tuning.
+ * @return The path, empty when none of the two environment variables is set.
+ */
+std::string tuningProfilePath() {
+    if (const char *path = std::getenv("LABMATRIX_TUNING")) {
+        return path;
+    }
+    if (const char *home = std::getenv("HOME")) {
+        return std::string(home) + "/.labmatrix_tuning";
+    }
+    return "";
+}
+
+/**
+ * @brief Parses a comma-separated list of operations.
+ * @param list The list, for example "add,product".
+ * @return The operations, in the order of the list.
+ * @throws std::runtime_error if an operation is unknown or the list is empty.
+ */
+std::vector<Operation> parseOperations(const std::string &list) {
+    std::vector<Operation> operations;
+    std::istringstream names(list);
+    for (std::string name; std::getline(names, name, ',');) {
+        if (name == "add") {
+            operations.push_back({name, "one + two", [](const Matrix &a, const Matrix &b) { return a + b; }});
+        } else if (name == "sub") {
+            operations.push_back({name, "one - two", [](const Matrix &a, const Matrix &b) { return a - b; }});
+        } else if (name == "multiply") {
+            operations.push_back({name, "one x two", [](const Matrix &a, const Matrix &b) { return a * b; }});
+        } else if (name == "product") {
+            operations.push_back({name, "one . two", [](const Matrix &a, const Matrix &b) { return a.product(b); }});
+        } else {
+            throw std::runtime_error("unknown operation " + name);
+        }
+    }
+    if (operations.empty()) {
+        throw std::runtime_error("no operation selected");
+    }
+    return operations;
+}
+
+/**
+ * @brief Parses the options following the dimensions and the modulus, their values given as --name=value or as
+ * --name value.
+ * @return The options, the defaults for the ones not given.
+ * @throws std::runtime_error if an option is unknown, or its value missing or invalid.
+ */
+Options parseOptions(int argc, char *argv[]) {
+    Options options;
+    options.operations = parseOperations("add,sub,multiply");
+
+    for (int i = 6; i < argc; ++i) {
+        const std::string option = argv[i];
+        const std::size_t equal = option.find('=');
+        const std::string name = option.substr(0, equal);
+        std::string value = equal == std::string::npos ? "" : option.substr(equal + 1);
+
+        if (option.rfind("--", 0) != 0) {
+            throw std::runtime_error("unexpected argument " + option);
+        }
+
+        // The options with a value take the next argument when it is not given after '='
+        const bool takesValue = name == "--ops" || name == "--repeat" || name == "--threads" || name == "--seed";
+        if (takesValue && equal == std::string::npos) {
+            if (i + 1 == argc) {
+                throw std::runtime_error("missing value of the option " + option);
+            }
+            value = argv[++i];
+        }
+
+        if (name == "--quiet" && equal == std::string::npos) {
+            options.quiet = true;
+        } else if (name == "--ops") {
+            options.operations = parseOperations(value);
+        } else if (name == "--repeat") {
+            options.repeat = parseArg(value.c_str());
+            if (options.repeat == 0) {
+                throw std::runtime_error("the repeat count cannot be zero");
+            }
+        } else if (name == "--threads") {
+            options.threads = parseArg(value.c_str());
+        } else if (name == "--seed") {
+            options.seed = parseArg(value.c_str());
+        } else {
+            throw std::runtime_error("unknown option " + option);
+        }
+    }
+    return options;
+}
+
+/**
+ * @brief Formats the timings of an operation as a JSON object: latency percentiles (nearest rank) and, for the
+ * median run, the result elements computed per second and the gigabytes per second of the operands read and the
+ * result written once (the minimum traffic, a product reads its operands several times).
+ * @param operation The operation.
+ * @param nanoseconds The duration of each run.
+ * @return The JSON object.
+ */
+std::string timingJson(const Operation &operation, std::vector<double> nanoseconds, const Matrix &one,
+                       const Matrix &two, const Matrix &result) {
+    std::sort(nanoseconds.begin(), nanoseconds.end());
+    auto percentile = [&nanoseconds](double p) {
+        const auto rank = (std::size_t) std::ceil(p / 100 * double(nanoseconds.size()));
+        return nanoseconds[std::max<std::size_t>(rank, 1) - 1];
+    };
+    double total = 0;
+    for (double duration: nanoseconds) {
+        total += duration;
+    }
+
+    auto elementsOf = [](const Matrix &matrix) { return double(matrix.getRows()) * matrix.getColumns(); };
+    const double seconds = std::max(percentile(50), 1.0) * 1e-9;
+    const double bytes = (elementsOf(one) + elementsOf(two) + elementsOf(result)) * sizeof(unsigned);
+
+    std::ostringstream json;
+    json << "{\"name\": \"" << operation.name << "\", \"runs\": " << nanoseconds.size()
+         << ", \"min_ns\": " << std::llround(nanoseconds.front()) << ", \"p50_ns\": " << std::llround(percentile(50))
+         << ", \"p90_ns\": " << std::llround(percentile(90)) << ", \"p99_ns\": " << std::llround(percentile(99))
+         << ", \"max_ns\": " << std::llround(nanoseconds.back())
+         << ", \"mean_ns\": " << std::llround(total / double(nanoseconds.size()))
+         << ", \"elements_per_second\": " << elementsOf(result) / seconds
+         << ", \"gigabytes_per_second\": " << bytes / seconds * 1e-9 << "}";
+    return json.str();
+}
+
+/**
+ * @brief Gets the peak resident set size of the process.
+ * @return The peak resident set size in kilobytes, -1 if it is unavailable.
+ */
+long peakResidentKilobytes() {
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+    return usage.ru_maxrss;
+}
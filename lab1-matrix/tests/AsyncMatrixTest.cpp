@@ -0,0 +1,113 @@
+/**
+* @file AsyncMatrixTest.cpp
+ * @brief This file is the test file for the AsyncMatrix and Executor classes
+*/
+#include "gtest/gtest.h"
+#include "../src/AsyncMatrix/AsyncMatrix.hpp"
+#include "../src/Utils/Parallel.h"
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @test The executor runs the submitted tasks and gives their results and exceptions through futures
+ */
+TEST(AsyncMatrixTest, ExecutorRunsTasks) {
+    Executor executor(3);
+    EXPECT_EQ(executor.getThreadCount(), 3u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 20; ++i) {
+        results.push_back(executor.submit([i] { return i * i; }));
+    }
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(results[std::size_t(i)].get(), i * i);
+    }
+
+    std::future<int> failure = executor.submit([]() -> int { throw std::runtime_error("failure"); });
+    EXPECT_THROW(failure.get(), std::runtime_error);
+}
+
+/**
+ * @test The parallel loops of the kernels called by a task run on the thread of the task
+ */
+TEST(AsyncMatrixTest, ExecutorRunsLoopsInline) {
+    Executor executor(2);
+    Parallel::setThreadCount(4);
+    std::future<bool> sameThread = executor.submit([] {
+        const std::thread::id task = std::this_thread::get_id();
+        bool same = true;
+        Parallel::forRange(0, 100, 1, [&](std::size_t first, std::size_t last) {
+            same = same && std::this_thread::get_id() == task && first == 0 && last == 100;
+        });
+        return same;
+    });
+    EXPECT_TRUE(sameThread.get());
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test A graph of asynchronous operations gives the same results as the synchronous operations
+ */
+TEST(AsyncMatrixTest, GraphMatchesSynchronousOperations) {
+    Executor executor(2);
+    const Matrix a(6, 5, 97), b(6, 5, 97), c(5, 4, 97);
+
+    const AsyncMatrix asyncA = AsyncMatrix::ready(a, executor);
+    const AsyncMatrix asyncB = AsyncMatrix::run([b] { return b; }, executor);
+    const AsyncMatrix asyncC = AsyncMatrix::ready(c, executor);
+
+    const AsyncMatrix sum = asyncA.add(asyncB);
+    const AsyncMatrix result = sum.multiplyScalar(3).product(asyncC).transpose();
+    const AsyncMatrix difference = asyncA.sub(asyncB).multiply(sum).addScalar(5);
+
+    EXPECT_TRUE(result.get() == (a + b).multiplyScalarStatic(3).product(c).transpose());
+    EXPECT_TRUE(difference.get() == ((a - b) * (a + b)).addScalarStatic(5));
+    EXPECT_TRUE(sum.isReady());
+
+    const AsyncMatrix generated = AsyncMatrix::random(4, 7, 11, executor);
+    const Matrix &matrix = generated.get();
+    EXPECT_EQ(matrix.getRows(), 4u);
+    EXPECT_EQ(matrix.getColumns(), 7u);
+}
+
+/**
+ * @test A node starts once its inputs are computed, while the independent nodes run meanwhile
+ */
+TEST(AsyncMatrixTest, NodesStartWhenInputsAreReady) {
+    Executor executor(2);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    const Matrix a(3, 3, 97), b(3, 3, 97);
+    const AsyncMatrix slow = AsyncMatrix::run([a, released] {
+        released.wait();
+        return a;
+    }, executor);
+    const AsyncMatrix dependent = slow.add(AsyncMatrix::ready(b, executor));
+    const AsyncMatrix independent = AsyncMatrix::ready(b, executor).multiplyScalar(2);
+
+    // The independent node is computed by the other thread, the dependent one waits for the slow one
+    EXPECT_TRUE(independent.get() == b.multiplyScalarStatic(2));
+    EXPECT_FALSE(dependent.isReady());
+
+    release.set_value();
+    EXPECT_TRUE(dependent.get() == a + b);
+}
+
+/**
+ * @test An exception thrown by a node is rethrown by get() on the nodes depending on it
+ */
+TEST(AsyncMatrixTest, ErrorsPropagate) {
+    Executor executor(2);
+    const AsyncMatrix a = AsyncMatrix::ready(Matrix(2, 3, 97), executor);
+    const AsyncMatrix b = AsyncMatrix::ready(Matrix(2, 3, 89), executor);
+
+    const AsyncMatrix invalid = a.add(b);
+    const AsyncMatrix dependent = invalid.addScalar(1).product(a.transpose());
+    EXPECT_THROW(static_cast<void>(invalid.get()), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(dependent.get()), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(a.product(a).get()), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(AsyncMatrix::random(0, 3, 97, executor).get()), std::runtime_error);
+}
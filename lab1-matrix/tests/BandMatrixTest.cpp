@@ -0,0 +1,159 @@
+/**
+* @file BandMatrixTest.cpp
+ * @brief This file is the test file for the BandMatrix class
+*/
+#include "gtest/gtest.h"
+#include "../src/BandMatrix/BandMatrix.hpp"
+#include <sstream>
+
+/**
+ * @brief Checks that two dense matrices have the same dimensions and elements.
+ */
+static void expectSameBandElements(const Matrix &actual, const Matrix &expected) {
+    ASSERT_EQ(actual.getRows(), expected.getRows());
+    ASSERT_EQ(actual.getColumns(), expected.getColumns());
+    for (unsigned i = 0; i < expected.getRows(); ++i) {
+        for (unsigned j = 0; j < expected.getColumns(); ++j) {
+            EXPECT_EQ(actual.get(i, j), expected.get(i, j)) << "at (" << i << ", " << j << ")";
+        }
+    }
+}
+
+/**
+ * @test Only the elements within the band are kept, the factories give the expected bandwidths
+ */
+TEST(BandMatrixTest, KeepsOnlyTheBand) {
+    Matrix dense(6, 8, 101);
+    BandMatrix band(dense, 2, 1);
+    EXPECT_EQ(band.getLowerBandwidth(), 2u);
+    EXPECT_EQ(band.getUpperBandwidth(), 1u);
+    for (unsigned i = 0; i < 6; ++i) {
+        for (unsigned j = 0; j < 8; ++j) {
+            const bool inBand = j + 2 >= i && j <= i + 1;
+            EXPECT_EQ(band.get(i, j), inBand ? dense.get(i, j) : 0u);
+        }
+    }
+    expectSameBandElements(BandMatrix(dense, 100, 100).toDense(), dense);
+
+    BandMatrix lower = BandMatrix::lowerTriangular(dense), upper = BandMatrix::upperTriangular(dense);
+    EXPECT_EQ(lower.getLowerBandwidth(), 5u);
+    EXPECT_EQ(lower.getUpperBandwidth(), 0u);
+    EXPECT_EQ(upper.getLowerBandwidth(), 0u);
+    EXPECT_EQ(upper.getUpperBandwidth(), 7u);
+    EXPECT_EQ(BandMatrix::diagonal(dense).getUpperBandwidth(), 0u);
+    EXPECT_EQ(BandMatrix::tridiagonal(dense).getLowerBandwidth(), 1u);
+
+    band.set(3, 1, 205);
+    EXPECT_EQ(band.get(3, 1), 3u);
+    EXPECT_THROW(band.set(3, 0, 1), std::out_of_range);
+    EXPECT_THROW(band.set(6, 0, 1), std::out_of_range);
+    EXPECT_THROW((void) band.get(0, 8), std::out_of_range);
+
+    BandMatrix diagonal(2, 3, 0, 0, 5);
+    diagonal.set(0, 0, 1);
+    diagonal.set(1, 1, 2);
+    std::stringstream stream;
+    stream << diagonal;
+    EXPECT_EQ(stream.str(), "1 0 0 \n0 2 0 \n");
+}
+
+/**
+ * @test The element-wise operations between bands match the dense ones, on the union or intersection of the bands
+ */
+TEST(BandMatrixTest, ElementWiseBetweenBands) {
+    BandMatrix a(Matrix(7, 9, 97), 1, 2), b(Matrix(8, 6, 97), 0, 3);
+    const Matrix denseA = a.toDense(), denseB = b.toDense();
+
+    BandMatrix sum = a + b, difference = a - b, hadamard = a * b;
+    EXPECT_EQ(sum.getRows(), 8u);
+    EXPECT_EQ(sum.getColumns(), 9u);
+    EXPECT_EQ(sum.getLowerBandwidth(), 1u);
+    EXPECT_EQ(sum.getUpperBandwidth(), 3u);
+    EXPECT_EQ(hadamard.getLowerBandwidth(), 0u);
+    EXPECT_EQ(hadamard.getUpperBandwidth(), 2u);
+
+    expectSameBandElements(sum.toDense(), denseA + denseB);
+    expectSameBandElements(difference.toDense(), denseA - denseB);
+    expectSameBandElements(hadamard.toDense(), denseA * denseB);
+
+    a.sub(b).add(b);
+    expectSameBandElements(a.toDense(), (denseA - denseB) + denseB);
+    a.multiply(b);
+    expectSameBandElements(a.toDense(), ((denseA - denseB) + denseB) * denseB);
+}
+
+/**
+ * @test The element-wise operations with a dense matrix match the dense ones
+ */
+TEST(BandMatrixTest, ElementWiseWithDense) {
+    BandMatrix band(Matrix(6, 6, 89), 1, 1);
+    const Matrix dense(5, 7, 89), bandDense = band.toDense();
+
+    expectSameBandElements(band + dense, bandDense + dense);
+    expectSameBandElements(dense + band, dense + bandDense);
+    expectSameBandElements(band - dense, bandDense - dense);
+    expectSameBandElements(dense - band, dense - bandDense);
+
+    BandMatrix hadamard = band * dense;
+    EXPECT_EQ(hadamard.getLowerBandwidth(), 1u);
+    EXPECT_EQ(hadamard.getUpperBandwidth(), 1u);
+    expectSameBandElements(hadamard.toDense(), bandDense * dense);
+    expectSameBandElements((dense * band).toDense(), dense * bandDense);
+}
+
+/**
+ * @test The products with a band matrix on either side match the dense product, with a modulo close to 2^32
+ */
+TEST(BandMatrixTest, ProductsMatchDense) {
+    const unsigned modulo = 4294967291u;
+    BandMatrix a(Matrix(9, 7, modulo), 2, 1), b(Matrix(7, 8, modulo), 1, 3);
+    const Matrix dense(7, 5, modulo), left(4, 9, modulo);
+
+    BandMatrix product = a.product(b);
+    EXPECT_EQ(product.getLowerBandwidth(), 3u);
+    EXPECT_EQ(product.getUpperBandwidth(), 4u);
+    expectSameBandElements(product.toDense(), a.toDense().product(b.toDense()));
+    expectSameBandElements(a.product(dense), a.toDense().product(dense));
+    expectSameBandElements(a.leftProduct(left), left.product(a.toDense()));
+
+    // The product of lower triangular matrices stays lower triangular
+    const Matrix square(6, 6, modulo);
+    BandMatrix lower = BandMatrix::lowerTriangular(square);
+    BandMatrix lowerSquare = lower.product(lower);
+    EXPECT_EQ(lowerSquare.getUpperBandwidth(), 0u);
+    expectSameBandElements(lowerSquare.toDense(), lower.toDense().product(lower.toDense()));
+}
+
+/**
+ * @test The transpose exchanges the bands below and above the diagonal
+ */
+TEST(BandMatrixTest, Transpose) {
+    const Matrix dense(5, 8, 31);
+    BandMatrix band(dense, 1, 3);
+    BandMatrix transposed = band.transpose();
+    EXPECT_EQ(transposed.getRows(), 8u);
+    EXPECT_EQ(transposed.getColumns(), 5u);
+    EXPECT_EQ(transposed.getLowerBandwidth(), 3u);
+    EXPECT_EQ(transposed.getUpperBandwidth(), 1u);
+    for (unsigned i = 0; i < 5; ++i) {
+        for (unsigned j = 0; j < 8; ++j) {
+            EXPECT_EQ(transposed.get(j, i), band.get(i, j));
+        }
+    }
+}
+
+/**
+ * @test The arguments and the operands must be valid
+ */
+TEST(BandMatrixTest, InvalidArguments) {
+    EXPECT_THROW(BandMatrix(2, 2, 0, 0, 0), std::invalid_argument);
+    EXPECT_THROW(BandMatrix(0, 2, 0, 0, 7), std::runtime_error);
+    EXPECT_THROW(BandMatrix(2, 0, 0, 0, 7), std::runtime_error);
+
+    BandMatrix band(3, 4, 1, 1, 7);
+    EXPECT_THROW((void) band.addStatic(BandMatrix(3, 4, 1, 1, 11)), std::invalid_argument);
+    EXPECT_THROW((void) band.addStatic(Matrix(3, 4, 11)), std::invalid_argument);
+    EXPECT_THROW((void) band.product(BandMatrix(3, 4, 1, 1, 7)), std::invalid_argument);
+    EXPECT_THROW((void) band.product(Matrix(3, 4, 7)), std::invalid_argument);
+    EXPECT_THROW((void) band.leftProduct(Matrix(3, 4, 7)), std::invalid_argument);
+}
@@ -0,0 +1,106 @@
+/**
+* @file BitMatrixTest.cpp
+ * @brief This file is the test file for the BitMatrix class
+*/
+#include "gtest/gtest.h"
+#include "../src/BitMatrix/BitMatrix.hpp"
+#include <sstream>
+
+/**
+ * Verifies that a bit matrix and a dense matrix hold the same elements
+ * @param bits The bit matrix
+ * @param dense The dense matrix
+ * @return true if both matrices have the same size and elements, false otherwise
+ */
+bool isSameMatrix(const BitMatrix &bits, const Matrix &dense) {
+    if (bits.getRows() != dense.getRows() || bits.getColumns() != dense.getColumns()) {
+        return false;
+    }
+    for (unsigned i = 0; i < dense.getRows(); ++i) {
+        for (unsigned j = 0; j < dense.getColumns(); ++j) {
+            if (unsigned(bits.get(i, j)) != dense.get(i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @test Converting a dense matrix to a bit matrix and back must give the same elements, across several words
+ */
+TEST(BitMatrixTest, DenseRoundTrip) {
+    Matrix dense(5, 130, 2);
+    BitMatrix bits(dense);
+    EXPECT_TRUE(isSameMatrix(bits, dense));
+    EXPECT_TRUE(isSameMatrix(bits, bits.toMatrix()));
+}
+
+/**
+ * @test Only a matrix with a modulo of 2 can be converted
+ */
+TEST(BitMatrixTest, ConversionWithInvalidModulo) {
+    EXPECT_THROW(BitMatrix(Matrix(3, 4, 3)), std::invalid_argument);
+    EXPECT_THROW(BitMatrix(0, 4), std::runtime_error);
+}
+
+/**
+ * @test An element can be set and cleared
+ */
+TEST(BitMatrixTest, SetAndGet) {
+    BitMatrix bits(2, 70);
+    bits.set(1, 65, true);
+    EXPECT_TRUE(bits.get(1, 65));
+    bits.set(1, 65, false);
+    EXPECT_FALSE(bits.get(1, 65));
+    EXPECT_THROW(bits.set(2, 0, true), std::out_of_range);
+}
+
+/**
+ * @test The operations must give the same result as the dense operations, including different sizes
+ */
+TEST(BitMatrixTest, OperationsMatchDense) {
+    Matrix a(9, 100, 2), b(12, 70, 2);
+    BitMatrix bitsA(a), bitsB(b);
+
+    EXPECT_TRUE(isSameMatrix(bitsA + bitsB, a + b));
+    EXPECT_TRUE(isSameMatrix(bitsA - bitsB, a - b));
+    EXPECT_TRUE(isSameMatrix(bitsA * bitsB, a * b));
+}
+
+/**
+ * @test A matrix must be able to add itself and the sum is 0 for each element
+ */
+TEST(BitMatrixTest, AddItself) {
+    BitMatrix bits(Matrix(4, 80, 2));
+    bits.add(bits);
+    EXPECT_TRUE(isSameMatrix(bits, Matrix::zeros(4, 80, 2)));
+}
+
+/**
+ * @test The Four Russians product must match the definition of the product, with a partial last block
+ */
+TEST(BitMatrixTest, ProductIsValid) {
+    const unsigned ROWS = 13, INNER = 75, COLS = 67;
+    Matrix a(ROWS, INNER, 2), b(INNER, COLS, 2);
+    BitMatrix result = BitMatrix(a).product(BitMatrix(b));
+
+    ASSERT_EQ(result.getRows(), ROWS);
+    ASSERT_EQ(result.getColumns(), COLS);
+    for (unsigned i = 0; i < ROWS; ++i) {
+        for (unsigned j = 0; j < COLS; ++j) {
+            unsigned expected = 0;
+            for (unsigned k = 0; k < INNER; ++k) {
+                expected ^= a.get(i, k) & b.get(k, j);
+            }
+            EXPECT_EQ(unsigned(result.get(i, j)), expected);
+        }
+    }
+}
+
+/**
+ * @test The matrix product with incompatible dimensions must throw an exception
+ */
+TEST(BitMatrixTest, ProductWithInvalidDimensions) {
+    EXPECT_THROW(BitMatrix(3, 4).product(BitMatrix(3, 4)), std::invalid_argument);
+}
@@ -0,0 +1,88 @@
+/**
+* @file BufferPoolTest.cpp
+ * @brief This file is the test file for the BufferPool class
+*/
+#include "gtest/gtest.h"
+#include "../src/Matrix/BufferPool.hpp"
+#include "../src/Matrix/Matrix.hpp"
+#include <thread>
+
+/**
+ * @test A freed buffer must be reused by the next allocation of the same size class
+ */
+TEST(BufferPoolTest, FreedBufferIsReused) {
+    BufferPool pool;
+    void *first = pool.allocate(100, alignof(unsigned));
+    pool.deallocate(first, 100, alignof(unsigned));
+
+    // 100 and 110 bytes are both in the 112 bytes class
+    void *second = pool.allocate(110, alignof(unsigned));
+    EXPECT_EQ(first, second);
+    pool.deallocate(second, 110, alignof(unsigned));
+
+    BufferPool::Stats stats = pool.getStats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.cachedBytes, 112);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 0.5);
+}
+
+/**
+ * @test A buffer of another size class must not be reused
+ */
+TEST(BufferPoolTest, OtherClassIsNotReused) {
+    BufferPool pool;
+    void *small = pool.allocate(100, alignof(unsigned));
+    pool.deallocate(small, 100, alignof(unsigned));
+
+    void *large = pool.allocate(4000, alignof(unsigned));
+    EXPECT_EQ(pool.getStats().hits, 0);
+    pool.deallocate(large, 4000, alignof(unsigned));
+}
+
+/**
+ * @test The buffers freed beyond the maximum number of cached bytes must be given back to the upstream resource
+ */
+TEST(BufferPoolTest, CacheIsBounded) {
+    BufferPool pool(256);
+    void *first = pool.allocate(256, alignof(unsigned));
+    void *second = pool.allocate(256, alignof(unsigned));
+    pool.deallocate(first, 256, alignof(unsigned));
+    pool.deallocate(second, 256, alignof(unsigned));
+    EXPECT_EQ(pool.getStats().cachedBytes, 256);
+
+    pool.release();
+    EXPECT_EQ(pool.getStats().cachedBytes, 0);
+}
+
+/**
+ * @test The temporaries of the operations must reuse the buffers of the pool once the loop is in steady state
+ */
+TEST(BufferPoolTest, MatrixTemporariesAreReused) {
+    BufferPool pool;
+    Matrix lhs(20, 30, 7, &pool), rhs(20, 30, 7, &pool);
+    for (int i = 0; i < 100; ++i) {
+        Matrix result = lhs + rhs * lhs - rhs;
+        EXPECT_EQ(result.getResource(), &pool);
+    }
+
+    BufferPool::Stats stats = pool.getStats();
+    EXPECT_GT(stats.hitRate(), 0.9);
+    EXPECT_EQ(Matrix::zeros(2, 2, 7).getResource(), std::pmr::get_default_resource());
+}
+
+/**
+ * @test Each thread must get its own pool
+ */
+TEST(BufferPoolTest, LocalPoolPerThread) {
+    BufferPool *mainPool = &BufferPool::local(), *otherPool = nullptr;
+    std::thread thread([&otherPool] {
+        otherPool = &BufferPool::local();
+        Matrix m(4, 4, 5, otherPool);
+        m.add(Matrix(4, 4, 5, otherPool));
+    });
+    thread.join();
+
+    EXPECT_EQ(mainPool, &BufferPool::local());
+    EXPECT_NE(mainPool, otherPool);
+}
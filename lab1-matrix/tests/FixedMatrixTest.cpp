@@ -0,0 +1,96 @@
+/**
+* @file FixedMatrixTest.cpp
+ * @brief This file is the test file for the FixedMatrix class
+*/
+#include "gtest/gtest.h"
+#include "../src/FixedMatrix/FixedMatrix.hpp"
+
+using Fixed2x3 = FixedMatrix<2, 3, 7>;
+using Fixed2x2 = FixedMatrix<2, 2>;
+using Fixed4x4 = FixedMatrix<4, 4, 13>;
+
+/**
+ * @test The operations can be evaluated at compile time
+ */
+TEST(FixedMatrixTest, OperationsAreConstexpr) {
+    constexpr Fixed2x3 a({1, 2, 3, 4, 5, 6}), b({6, 5, 4, 3, 2, 1});
+
+    static_assert((a + b) == Fixed2x3({0, 0, 0, 0, 0, 0}));
+    static_assert((a - b) == Fixed2x3({2, 4, 6, 1, 3, 5}));
+    static_assert((a * b) == Fixed2x3({6, 3, 5, 5, 3, 6}));
+
+    constexpr FixedMatrix<3, 2, 7> c({1, 0, 0, 1, 1, 1});
+    static_assert(a.product(c) == FixedMatrix<2, 2, 7>({4, 5, 3, 4}));
+}
+
+/**
+ * @test The values given to the constructor are reduced modulo n
+ */
+TEST(FixedMatrixTest, ValuesAreReduced) {
+    Fixed2x3 m({7, 8, 9, 10, 11, 12});
+    EXPECT_EQ(m.get(0, 0), 0);
+    EXPECT_EQ(m.get(1, 2), 5);
+    m.set(0, 1, 15);
+    EXPECT_EQ(m.get(0, 1), 1);
+    EXPECT_THROW((void) m.get(2, 0), std::out_of_range);
+}
+
+/**
+ * @test A runtime modulo must be valid and identical between the operands
+ */
+TEST(FixedMatrixTest, RuntimeModulo) {
+    Fixed2x2 a({3, 4, 5, 6}, 5), b({1, 1, 1, 1}, 5);
+    EXPECT_EQ((a + b).get(1, 1), 2);
+    EXPECT_THROW(a + Fixed2x2(7), std::invalid_argument);
+    EXPECT_THROW(Fixed2x2(0), std::invalid_argument);
+    EXPECT_THROW(Fixed2x3(5), std::invalid_argument);
+}
+
+/**
+ * @test Converting a dense matrix to a fixed matrix and back must give the same elements
+ */
+TEST(FixedMatrixTest, DenseRoundTrip) {
+    Matrix dense(2, 3, 7);
+    Fixed2x3 fixed(dense);
+    Matrix back = fixed.toMatrix();
+    for (unsigned i = 0; i < 2; ++i) {
+        for (unsigned j = 0; j < 3; ++j) {
+            EXPECT_EQ(fixed.get(i, j), dense.get(i, j));
+            EXPECT_EQ(back.get(i, j), dense.get(i, j));
+        }
+    }
+    EXPECT_THROW(Fixed2x3(Matrix(3, 2, 7)), std::invalid_argument);
+    EXPECT_THROW(Fixed2x3(Matrix(2, 3, 5)), std::invalid_argument);
+}
+
+/**
+ * @test The operations must give the same results as the Matrix operations
+ */
+TEST(FixedMatrixTest, OperationsMatchMatrix) {
+    Matrix lhs(4, 4, 13), rhs(4, 4, 13);
+    Fixed4x4 fixedLhs(lhs), fixedRhs(rhs);
+    Matrix sum = lhs + rhs, difference = lhs - rhs, product = lhs * rhs;
+
+    EXPECT_TRUE((fixedLhs + fixedRhs) == Fixed4x4(sum));
+    EXPECT_TRUE((fixedLhs - fixedRhs) == Fixed4x4(difference));
+    EXPECT_TRUE((fixedLhs * fixedRhs) == Fixed4x4(product));
+}
+
+/**
+ * @test The matrix product must match the definition of the product
+ */
+TEST(FixedMatrixTest, ProductIsValid) {
+    const unsigned MOD = 4294967291u;
+    Matrix lhs(3, 5, MOD), rhs(5, 2, MOD);
+    auto result = FixedMatrix<3, 5>(lhs).product(FixedMatrix<5, 2>(rhs));
+
+    for (unsigned i = 0; i < 3; ++i) {
+        for (unsigned j = 0; j < 2; ++j) {
+            unsigned long long expected = 0;
+            for (unsigned k = 0; k < 5; ++k) {
+                expected = (expected + (unsigned long long) lhs.get(i, k) * rhs.get(k, j) % MOD) % MOD;
+            }
+            EXPECT_EQ(result.get(i, j), expected);
+        }
+    }
+}
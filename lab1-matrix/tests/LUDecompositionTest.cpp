@@ -0,0 +1,123 @@
+/**
+* @file LUDecompositionTest.cpp
+ * @brief This file is the test file for the LUDecomposition class
+*/
+#include "gtest/gtest.h"
+#include "../src/LUDecomposition/LUDecomposition.hpp"
+#include "../src/SparseMatrix/SparseMatrix.hpp"
+#include "../src/Utils/Parallel.h"
+
+/**
+ * Verifies that a matrix is the identity matrix
+ * @param matrix The matrix
+ * @return true if the matrix is square with 1 on its diagonal and 0 elsewhere, false otherwise
+ */
+bool isIdentity(const Matrix &matrix) {
+    if (matrix.getRows() != matrix.getColumns()) {
+        return false;
+    }
+    for (unsigned i = 0; i < matrix.getRows(); ++i) {
+        for (unsigned j = 0; j < matrix.getColumns(); ++j) {
+            if (matrix.get(i, j) != (i == j ? 1u : 0u)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @test L * U must be the permuted matrix, for tall and wide matrices over several panels and a large modulo
+ */
+TEST(LUDecompositionTest, ProductIsPermutedMatrix) {
+    Parallel::setThreadCount(3);
+    for (unsigned mod: {1009u, 4294967291u}) {
+        for (auto [rows, columns]: {std::pair{140u, 75u}, std::pair{70u, 150u}}) {
+            Matrix a(rows, columns, mod);
+            LUDecomposition lu(a);
+            Matrix product = lu.getLower().product(lu.getUpper());
+
+            EXPECT_EQ(lu.getRank(), std::min(rows, columns));
+            for (unsigned i = 0; i < rows; ++i) {
+                for (unsigned j = 0; j < columns; ++j) {
+                    ASSERT_EQ(product.get(i, j), a.get(lu.getPermutation()[i], j));
+                }
+            }
+        }
+    }
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test The rank of a product of a n x r and a r x n matrix is r, and its determinant is 0
+ */
+TEST(LUDecompositionTest, RankOfDeficientMatrix) {
+    const unsigned MOD = 1000000007u, SIZE = 100, RANK = 37;
+    Matrix a = Matrix(SIZE, RANK, MOD).product(Matrix(RANK, SIZE, MOD));
+    EXPECT_EQ(a.rank(), RANK);
+    EXPECT_EQ(a.determinant(), 0u);
+    EXPECT_THROW((void) a.inverse(), std::runtime_error);
+    EXPECT_EQ(Matrix::zeros(5, 7, MOD).rank(), 0u);
+}
+
+/**
+ * @test The determinant of a known matrix, of a swap of two rows and the determinant of a product
+ */
+TEST(LUDecompositionTest, DeterminantIsValid) {
+    const unsigned MOD = 1009;
+    // | 0 2 1 |
+    // | 3 0 4 |  det = 0 * (0 - 4) - 2 * (3 - 20) + 1 * (3 - 0) = 37
+    // | 5 1 1 |
+    Matrix a = SparseMatrix(3, 3, MOD, {{0, 1, 2}, {0, 2, 1}, {1, 0, 3}, {1, 2, 4},
+                                       {2, 0, 5}, {2, 1, 1}, {2, 2, 1}}).toDense();
+    EXPECT_EQ(a.determinant(), 37u);
+
+    // Swapping the first two rows changes the sign
+    Matrix swapped = SparseMatrix(3, 3, MOD, {{1, 1, 2}, {1, 2, 1}, {0, 0, 3}, {0, 2, 4},
+                                             {2, 0, 5}, {2, 1, 1}, {2, 2, 1}}).toDense();
+    EXPECT_EQ(swapped.determinant(), MOD - 37);
+
+    Matrix b(80, 80, MOD), c(80, 80, MOD);
+    EXPECT_EQ(b.product(c).determinant(), (unsigned long long) b.determinant() * c.determinant() % MOD);
+}
+
+/**
+ * @test The product of a matrix and its inverse is the identity, and the solution of a system satisfies it
+ */
+TEST(LUDecompositionTest, InverseAndSolve) {
+    Parallel::setThreadCount(3);
+    for (unsigned mod: {1000000007u, 4294967291u}) {
+        Matrix a(90, 90, mod), b(90, 5, mod);
+        LUDecomposition lu(a);
+        ASSERT_EQ(lu.getRank(), 90u);
+
+        Matrix inverse = lu.inverse();
+        EXPECT_TRUE(isIdentity(a.product(inverse)));
+        EXPECT_TRUE(isIdentity(inverse.product(a)));
+
+        Matrix x = lu.solve(b), check = a.product(x);
+        for (unsigned i = 0; i < 90; ++i) {
+            for (unsigned j = 0; j < 5; ++j) {
+                EXPECT_EQ(check.get(i, j), b.get(i, j));
+            }
+        }
+    }
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test The decomposition needs a prime modulo, and the operations need a square matrix and matching operands
+ */
+TEST(LUDecompositionTest, InvalidArguments) {
+    EXPECT_THROW(LUDecomposition(Matrix(4, 4, 1000)), std::invalid_argument);
+    EXPECT_THROW(LUDecomposition(Matrix(4, 4, 1)), std::invalid_argument);
+    EXPECT_THROW((void) Matrix(3, 4, 7).determinant(), std::invalid_argument);
+    EXPECT_THROW((void) LUDecomposition(Matrix(3, 4, 7)).inverse(), std::invalid_argument);
+
+    Matrix a = SparseMatrix(2, 2, 7, {{0, 0, 1}, {1, 1, 1}}).toDense();
+    EXPECT_THROW((void) a.solve(Matrix(3, 1, 7)), std::invalid_argument);
+    EXPECT_THROW((void) a.solve(Matrix(2, 1, 5)), std::invalid_argument);
+
+    Matrix moved(std::move(a));
+    EXPECT_THROW(LUDecomposition{a}, std::runtime_error);
+}
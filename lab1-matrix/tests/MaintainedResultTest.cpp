@@ -0,0 +1,155 @@
+/**
+* @file MaintainedResultTest.cpp
+ * @brief This file is the test file for the MaintainedResult class
+*/
+#include "gtest/gtest.h"
+#include "../src/MaintainedResult/MaintainedResult.hpp"
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @test The setters record the written elements, merged by rows or columns, and other modifications the whole matrix
+ */
+TEST(MaintainedResultTest, DirtyRegions) {
+    Matrix a(5, 6, 97);
+    const uint64_t initial = a.getGeneration();
+    EXPECT_TRUE(a.getDirtyRegions(initial).empty());
+
+    a.set(1, 2, 100);
+    EXPECT_EQ(a.get(1, 2), 3u);
+    a.set(1, 3, 4);
+    a.setRow(3, {1, 2, 3, 4, 5, 6});
+    a.setRow(4, {7, 8, 9, 10, 11, 12});
+    std::vector<Matrix::Region> regions = a.getDirtyRegions(initial);
+    ASSERT_EQ(regions.size(), 2u);
+    EXPECT_EQ(regions[0].firstRow, 1u);
+    EXPECT_EQ(regions[0].lastRow, 2u);
+    EXPECT_EQ(regions[0].firstColumn, 2u);
+    EXPECT_EQ(regions[0].lastColumn, 4u);
+    EXPECT_EQ(regions[1].firstRow, 3u);
+    EXPECT_EQ(regions[1].lastRow, 5u);
+    EXPECT_EQ(regions[1].firstColumn, 0u);
+    EXPECT_EQ(regions[1].lastColumn, 6u);
+    EXPECT_EQ(a.get(4, 5), 12u);
+
+    // A reader that already saw the rows only gets the newer changes
+    const uint64_t afterRows = a.getGeneration();
+    a.set(0, 5, 1);
+    regions = a.getDirtyRegions(afterRows);
+    ASSERT_EQ(regions.size(), 1u);
+    EXPECT_EQ(regions[0].firstRow, 0u);
+    EXPECT_EQ(regions[0].firstColumn, 5u);
+    EXPECT_EQ(a.getDirtyRegions(initial).size(), 3u);
+
+    const uint64_t beforeScalar = a.getGeneration();
+    a.addScalar(1);
+    for (uint64_t since: {initial, beforeScalar}) {
+        regions = a.getDirtyRegions(since);
+        ASSERT_EQ(regions.size(), 1u);
+        EXPECT_EQ(regions[0].lastRow, 5u);
+        EXPECT_EQ(regions[0].lastColumn, 6u);
+    }
+    EXPECT_TRUE(a.getDirtyRegions(a.getGeneration()).empty());
+
+    // A copy shares the elements until one of them is written
+    const Matrix copy(a);
+    a.set(0, 0, 42);
+    EXPECT_EQ(a.get(0, 0), 42u);
+    EXPECT_NE(copy.get(0, 0), 42u);
+
+    EXPECT_THROW(a.set(5, 0, 1), std::out_of_range);
+    EXPECT_THROW(a.setRow(0, {1, 2}), std::invalid_argument);
+}
+
+/**
+ * @test An element-wise result only recomputes the written elements and matches the operators
+ */
+TEST(MaintainedResultTest, ElementWiseUpdates) {
+    Matrix a(12, 9, 97), b(10, 11, 97);
+    MaintainedResult sum(a, b, MaintainedResult::Operation::Add);
+    EXPECT_TRUE(sum.get() == a + b);
+    EXPECT_TRUE(MaintainedResult(a, b, MaintainedResult::Operation::Sub).get() == a - b);
+
+    a.set(3, 4, 50);
+    EXPECT_EQ(sum.update(), 1u);
+    EXPECT_TRUE(sum.get() == a + b);
+    b.setRow(9, std::vector<unsigned>(11, 7));
+    EXPECT_EQ(sum.update(), 11u);
+    EXPECT_EQ(sum.update(), 0u);
+    EXPECT_TRUE(sum.get() == a + b);
+
+    Matrix c(4, 4, 97), d(4, 4, 97);
+    MaintainedResult product(c, d, MaintainedResult::Operation::Multiply);
+    c.multiplyScalar(3);
+    EXPECT_EQ(product.update(), 16u);
+    EXPECT_TRUE(product.get() == c * d);
+
+    // New dimensions need a complete computation
+    d = Matrix(5, 3, 97);
+    EXPECT_EQ(product.update(), 20u);
+    EXPECT_TRUE(product.get() == c * d);
+}
+
+/**
+ * @test A maintained product recomputes the rows and columns depending on the written elements
+ */
+TEST(MaintainedResultTest, ProductUpdates) {
+    Matrix a(8, 6, 4294967291u), b(6, 7, 4294967291u);
+    MaintainedResult product(a, b, MaintainedResult::Operation::Product);
+    EXPECT_TRUE(product.get() == a.product(b));
+
+    a.set(2, 5, 4294967290u);
+    EXPECT_EQ(product.update(), 7u);
+    EXPECT_TRUE(product.get() == a.product(b));
+
+    b.set(1, 3, 123456789u);
+    b.set(2, 3, 987654321u);
+    EXPECT_EQ(product.update(), 8u);
+    EXPECT_TRUE(product.get() == a.product(b));
+
+    // The same matrix on both sides
+    Matrix c(5, 5, 1000003u);
+    MaintainedResult square(c, c, MaintainedResult::Operation::Product);
+    c.set(4, 1, 999999u);
+    EXPECT_EQ(square.update(), 10u);
+    EXPECT_TRUE(square.get() == c.product(c));
+}
+
+/**
+ * @test Maintained results sharing an operand each see its changes, whichever is updated first
+ */
+TEST(MaintainedResultTest, SharedOperand) {
+    Matrix a(6, 5, 97), b(6, 5, 97), c(5, 4, 97);
+    MaintainedResult sum(a, b, MaintainedResult::Operation::Add);
+    MaintainedResult product(a, c, MaintainedResult::Operation::Product);
+    MaintainedResult square(a, a, MaintainedResult::Operation::Multiply);
+
+    a.set(0, 0, 5);
+    EXPECT_EQ(sum.update(), 1u);
+    EXPECT_TRUE(sum.get() == a + b);
+    EXPECT_TRUE(product.get() == a.product(c));
+    EXPECT_TRUE(square.get() == a * a);
+
+    // Many changes are kept apart or merged, never lost
+    for (unsigned k = 0; k < 200; ++k) {
+        a.set(k % 6, (k * 7) % 5, k);
+    }
+    EXPECT_TRUE(square.get() == a * a);
+    b.setRow(2, std::vector<unsigned>(5, 3));
+    EXPECT_TRUE(sum.get() == a + b);
+    EXPECT_TRUE(product.get() == a.product(c));
+    EXPECT_EQ(sum.update(), 0u);
+}
+
+/**
+ * @test Operands that do not match are refused, at construction and at update
+ */
+TEST(MaintainedResultTest, InvalidOperands) {
+    Matrix a(3, 4, 97), b(3, 4, 97), c(3, 4, 89);
+    EXPECT_THROW(MaintainedResult(a, c, MaintainedResult::Operation::Add), std::invalid_argument);
+    EXPECT_THROW(MaintainedResult(a, b, MaintainedResult::Operation::Product), std::invalid_argument);
+
+    MaintainedResult sum(a, b, MaintainedResult::Operation::Add);
+    b = Matrix(3, 4, 89);
+    EXPECT_THROW(sum.update(), std::invalid_argument);
+}
@@ -0,0 +1,116 @@
+/**
+* @file MatrixBatchTest.cpp
+ * @brief This file is the test file for the MatrixBatch class
+*/
+#include "gtest/gtest.h"
+#include "../src/MatrixBatch/MatrixBatch.hpp"
+#include "../src/Utils/Parallel.h"
+#include <vector>
+
+/**
+ * Verifies that two matrices have the same size and elements
+ * @param lhs The first matrix
+ * @param rhs The second matrix
+ * @return true if both matrices have the same size and elements, false otherwise
+ */
+bool haveSameElements(const Matrix &lhs, const Matrix &rhs) {
+    if (lhs.getRows() != rhs.getRows() || lhs.getColumns() != rhs.getColumns()) {
+        return false;
+    }
+    for (unsigned i = 0; i < lhs.getRows(); ++i) {
+        for (unsigned j = 0; j < lhs.getColumns(); ++j) {
+            if (lhs.get(i, j) != rhs.get(i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Fills a batch with random matrices and returns a copy of them.
+ * @param batch The batch to fill.
+ * @return The matrices stored in the batch.
+ */
+std::vector<Matrix> fillBatch(MatrixBatch &batch) {
+    std::vector<Matrix> matrices;
+    for (std::size_t b = 0; b < batch.size(); ++b) {
+        matrices.emplace_back(batch.getRows(), batch.getColumns(), batch.getModulo());
+        batch.set(b, matrices.back());
+    }
+    return matrices;
+}
+
+/**
+ * @test A matrix copied into a batch must be the same when copied out of it
+ */
+TEST(MatrixBatchTest, SetAndGetRoundTrip) {
+    MatrixBatch batch(5, 3, 4, 11);
+    std::vector<Matrix> matrices = fillBatch(batch);
+    for (std::size_t b = 0; b < batch.size(); ++b) {
+        EXPECT_TRUE(haveSameElements(batch.get(b), matrices[b]));
+    }
+}
+
+/**
+ * @test Setting a matrix with a different size, a different modulo or outside the batch must throw an exception
+ */
+TEST(MatrixBatchTest, SetInvalidMatrix) {
+    MatrixBatch batch(2, 3, 4, 11);
+    EXPECT_THROW(batch.set(0, Matrix(4, 3, 11)), std::invalid_argument);
+    EXPECT_THROW(batch.set(0, Matrix(3, 4, 7)), std::invalid_argument);
+    EXPECT_THROW(batch.set(2, Matrix(3, 4, 11)), std::out_of_range);
+    EXPECT_THROW(MatrixBatch(2, 3, 4, 0), std::invalid_argument);
+}
+
+/**
+ * @test The component by component operations must give the same results as the Matrix operations, using threads
+ */
+TEST(MatrixBatchTest, OperationsMatchMatrix) {
+    Parallel::setThreadCount(4);
+    MatrixBatch lhs(3000, 4, 4, 13), rhs(3000, 4, 4, 13);
+    std::vector<Matrix> lhsMatrices = fillBatch(lhs), rhsMatrices = fillBatch(rhs);
+
+    MatrixBatch sum = lhs + rhs, difference = lhs - rhs, product = lhs * rhs;
+    for (std::size_t b = 0; b < lhs.size(); b += 97) {
+        EXPECT_TRUE(haveSameElements(sum.get(b), lhsMatrices[b] + rhsMatrices[b]));
+        EXPECT_TRUE(haveSameElements(difference.get(b), lhsMatrices[b] - rhsMatrices[b]));
+        EXPECT_TRUE(haveSameElements(product.get(b), lhsMatrices[b] * rhsMatrices[b]));
+    }
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test The matrix product of each pair of matrices must match the definition of the product, using threads
+ */
+TEST(MatrixBatchTest, ProductIsValid) {
+    Parallel::setThreadCount(3);
+    const unsigned ROWS = 3, INNER = 5, COLS = 2, MOD = 101;
+    MatrixBatch lhs(2500, ROWS, INNER, MOD), rhs(2500, INNER, COLS, MOD);
+    std::vector<Matrix> lhsMatrices = fillBatch(lhs), rhsMatrices = fillBatch(rhs);
+    MatrixBatch result = lhs.product(rhs);
+
+    for (std::size_t b = 0; b < lhs.size(); b += 101) {
+        for (unsigned i = 0; i < ROWS; ++i) {
+            for (unsigned j = 0; j < COLS; ++j) {
+                unsigned long long expected = 0;
+                for (unsigned k = 0; k < INNER; ++k) {
+                    expected += (unsigned long long) lhsMatrices[b].get(i, k) * rhsMatrices[b].get(k, j);
+                }
+                EXPECT_EQ(result.get(b).get(i, j), expected % MOD);
+            }
+        }
+    }
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test Operations between incompatible batches must throw an exception
+ */
+TEST(MatrixBatchTest, IncompatibleBatches) {
+    MatrixBatch batch(4, 3, 3, 7);
+    EXPECT_THROW(batch + MatrixBatch(5, 3, 3, 7), std::invalid_argument);
+    EXPECT_THROW(batch - MatrixBatch(4, 3, 3, 5), std::invalid_argument);
+    EXPECT_THROW(batch * MatrixBatch(4, 3, 2, 7), std::invalid_argument);
+    EXPECT_THROW(batch.product(MatrixBatch(4, 2, 3, 7)), std::invalid_argument);
+}
@@ -5,11 +5,17 @@
 */
 #include "gtest/gtest.h"
 #include "../src/Matrix/Matrix.hpp"
+#include "../src/SparseMatrix/SparseMatrix.hpp"
+#include "../src/Vector/Vector.hpp"
 #include "../src/Utils/Utils.h"
+#include "../src/Utils/Parallel.h"
+#include "../src/Utils/Tuning.h"
+#include "../src/Utils/Modular.h"
 #include "../src/Operators/Sub/Sub.h"
 #include "../src/Operators/Add/Add.h"
 #include "../src/Operators/Multiply/Multiply.h"
 #include <string>
+#include <thread>
 #include <vector>
 using Vector2D = std::vector<std::vector<unsigned>>;
 /**
@@ -489,4 +495,632 @@ TEST(MatrixTest, DynamicSubIsValid) {
 TEST(MatrixTest, DynamicMultIsValid) {
     static Multiply op;
     testDynamicOperation(&Matrix::multiplyDynamic, op);
-}
\ No newline at end of file
+}
+/*********************** Copy-on-write *************************/
+
+/**
+ * @test A copy shares the elements until it is modified, the original matrix must not change
+ */
+TEST(MatrixTest, CopyOnWriteSharesUntilModified) {
+    const unsigned ROWS = 3, COLS = 4, MOD = 11;
+    Matrix m1(ROWS, COLS, MOD);
+    auto dataM1 = getInnerData(m1, ROWS, COLS);
+    Matrix m2(m1);
+
+    EXPECT_TRUE(m1.isShared());
+    EXPECT_TRUE(m2.isShared());
+
+    m2.add(m1);
+
+    EXPECT_FALSE(m1.isShared());
+    EXPECT_FALSE(m2.isShared());
+    EXPECT_EQ(getInnerData(m1, ROWS, COLS), dataM1);
+}
+
+/**
+ * @test When copy-on-write is disabled, a copy duplicates the elements immediately
+ */
+TEST(MatrixTest, CopyOnWriteDisabled) {
+    Matrix m1(3, 4, 11);
+    m1.setCopyOnWrite(false);
+    Matrix m2(m1);
+    Matrix m3 = Matrix(2, 2, 11);
+    m3 = m1;
+
+    EXPECT_FALSE(m1.isShared());
+    EXPECT_FALSE(m2.isShared());
+    EXPECT_FALSE(m3.isShared());
+    EXPECT_EQ(getInnerData(m1, 3, 4), getInnerData(m2, 3, 4));
+}
+
+/**
+ * @test Copies of the same matrix can be modified concurrently without changing the original matrix
+ */
+TEST(MatrixTest, CopyOnWriteConcurrentCopies) {
+    const unsigned ROWS = 8, COLS = 8, MOD = 13;
+    Matrix original(ROWS, COLS, MOD);
+    auto originalData = getInnerData(original, ROWS, COLS);
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < 4; ++t) {
+        threads.emplace_back([&original] {
+            for (unsigned n = 0; n < 100; ++n) {
+                Matrix copy(original);
+                copy.sub(copy);
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(getInnerData(original, ROWS, COLS), originalData);
+    EXPECT_FALSE(original.isShared());
+}
+
+/*********************** Parallel operations *************************/
+
+/**
+ * @test The operations on large matrices are split across threads and must give the same result as one thread
+ */
+TEST(MatrixTest, ParallelOperationsMatchSequential) {
+    // A grain of 4 rows, so that the rows are split in 4 chunks whatever the tuned grain
+    const unsigned ROWS = 520, COLS = 256, MOD = 31;
+    Matrix m1(ROWS, COLS, MOD), m2(ROWS + 5, 9, MOD);
+
+    Tuning::setProfile({1, 4 * COLS, 4 * COLS, 0});
+    Matrix sequential = (m1 + m2) * m1 - m2;
+    Tuning::setProfile({4, 4 * COLS, 4 * COLS, 0});
+    Matrix parallel = (m1 + m2) * m1 - m2;
+    Tuning::setProfile(Tuning::defaultProfile());
+
+    EXPECT_EQ(getInnerData(parallel, ROWS + 5, COLS), getInnerData(sequential, ROWS + 5, COLS));
+}
+
+/*********************** Transpose and product *************************/
+
+/**
+ * @brief Computes the matrix product by its definition, reducing after each product.
+ * @param lhs The left-hand side matrix.
+ * @param rhs The right-hand side matrix.
+ * @return The elements of the product.
+ */
+Vector2D naiveProduct(const Matrix &lhs, const Matrix &rhs) {
+    const unsigned long long mod = lhs.getModulo();
+    Vector2D result(lhs.getRows(), std::vector<unsigned>(rhs.getColumns()));
+    for (unsigned i = 0; i < lhs.getRows(); ++i) {
+        for (unsigned j = 0; j < rhs.getColumns(); ++j) {
+            unsigned long long sum = 0;
+            for (unsigned k = 0; k < lhs.getColumns(); ++k) {
+                sum = (sum + (unsigned long long) lhs.get(i, k) * rhs.get(k, j) % mod) % mod;
+            }
+            result[i][j] = unsigned(sum);
+        }
+    }
+    return result;
+}
+
+/**
+ * @test The transpose swaps the indices of every element, with sizes that are not multiples of the 8x8 blocks
+ */
+TEST(MatrixTest, TransposeIsValid) {
+    const unsigned ROWS = 37, COLS = 70;
+    Matrix m(ROWS, COLS, 101);
+    Matrix t = m.transpose();
+
+    ASSERT_EQ(t.getRows(), COLS);
+    ASSERT_EQ(t.getColumns(), ROWS);
+    for (unsigned i = 0; i < ROWS; ++i) {
+        for (unsigned j = 0; j < COLS; ++j) {
+            EXPECT_EQ(t.get(j, i), m.get(i, j));
+        }
+    }
+}
+
+/**
+ * @test The in-place transpose of a square matrix gives the same result as the out-of-place transpose
+ */
+TEST(MatrixTest, TransposeInPlaceIsValid) {
+    for (unsigned size: {1u, 7u, 8u, 45u, 64u}) {
+        Matrix m(size, size, 13);
+        Matrix expected = m.transpose();
+        Matrix copy(m);
+        m.transposeInPlace();
+        EXPECT_EQ(getInnerData(m, size, size), getInnerData(expected, size, size));
+
+        // The copy still shares the original elements, it must not be transposed
+        EXPECT_EQ(getInnerData(copy.transpose(), size, size), getInnerData(expected, size, size));
+    }
+    EXPECT_THROW(Matrix(3, 4, 5).transposeInPlace(), std::invalid_argument);
+}
+
+/**
+ * @test The operations with a transposed operand give the same result as with the built transpose
+ */
+TEST(MatrixTest, TransposedOperandOperations) {
+    const unsigned MOD = 19;
+    Matrix a(40, 30, MOD), b(35, 45, MOD);
+    Matrix bt = b.transpose();
+
+    EXPECT_EQ(getInnerData(a.addStatic(b, Matrix::Operand::Transposed), 45, 35), getInnerData(a + bt, 45, 35));
+    EXPECT_EQ(getInnerData(a.subStatic(b, Matrix::Operand::Transposed), 45, 35), getInnerData(a - bt, 45, 35));
+    EXPECT_EQ(getInnerData(a.multiplyStatic(b, Matrix::Operand::Transposed), 45, 35), getInnerData(a * bt, 45, 35));
+
+    // A square matrix with its own transpose, in place
+    Matrix square(33, 33, MOD);
+    Matrix expected = square + square.transpose();
+    square.add(square, Matrix::Operand::Transposed);
+    EXPECT_EQ(getInnerData(square, 33, 33), getInnerData(expected, 33, 33));
+}
+
+/**
+ * @test The element-wise operations stay exact with a modulo whose products or sums overflow 32 bits, with operands
+ * of different sizes and a transposed operand
+ */
+TEST(MatrixTest, OperationsWithLargeModulo) {
+    // 1 * 65520 wrapped to 65295 when computed in 32 bits from the shifted operands
+    Matrix one = Matrix::zeros(1, 1, 65521), other = Matrix::zeros(1, 1, 65521);
+    one.set(0, 0, 1);
+    other.set(0, 0, 65520);
+    EXPECT_EQ((one * other).get(0, 0), 65520u);
+
+    for (unsigned long long mod: {65521ull, 4294967291ull}) {
+        Matrix a(9, 12, unsigned(mod)), b(11, 10, unsigned(mod));
+        const Matrix bt = b.transpose();
+        const Matrix sum = a + b, difference = a - b, product = a * b;
+        const Matrix sumT = a.addStatic(bt, Matrix::Operand::Transposed);
+        const Matrix differenceT = a.subStatic(bt, Matrix::Operand::Transposed);
+        const Matrix productT = a.multiplyStatic(bt, Matrix::Operand::Transposed);
+        for (unsigned i = 0; i < 11; ++i) {
+            for (unsigned j = 0; j < 12; ++j) {
+                const unsigned long long x = i < 9 ? a.get(i, j) : 0, y = j < 10 ? b.get(i, j) : 0;
+                EXPECT_EQ(sum.get(i, j), (x + y) % mod);
+                EXPECT_EQ(difference.get(i, j), (x + mod - y) % mod);
+                EXPECT_EQ(product.get(i, j), x * y % mod);
+                EXPECT_EQ(sumT.get(i, j), sum.get(i, j));
+                EXPECT_EQ(differenceT.get(i, j), difference.get(i, j));
+                EXPECT_EQ(productT.get(i, j), product.get(i, j));
+            }
+        }
+    }
+}
+
+/**
+ * @test The matrix product matches its definition, with a normal and a transposed operand and several threads
+ */
+TEST(MatrixTest, ProductIsValid) {
+    const unsigned ROWS = 20, INNER = 37, COLS = 25, MOD = 1013;
+    Matrix a(ROWS, INNER, MOD), b(INNER, COLS, MOD);
+    Vector2D expected = naiveProduct(a, b);
+
+    Parallel::setThreadCount(3);
+    EXPECT_EQ(getInnerData(a.product(b), ROWS, COLS), expected);
+    EXPECT_EQ(getInnerData(a.product(b.transpose(), Matrix::Operand::Transposed), ROWS, COLS), expected);
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test The matrix product must stay exact when the reduction must be done at each product (modulo near 2^32)
+ */
+TEST(MatrixTest, ProductWithLargeModulo) {
+    const unsigned MOD = 4294967291u;
+    Matrix a(3, 40, MOD), b(40, 4, MOD);
+    Vector2D expected = naiveProduct(a, b);
+
+    EXPECT_EQ(getInnerData(a.product(b), 3, 4), expected);
+    EXPECT_EQ(getInnerData(a.product(b.transpose(), Matrix::Operand::Transposed), 3, 4), expected);
+}
+
+/**
+ * @test The matrix product with incompatible dimensions or modulo must throw an exception
+ */
+TEST(MatrixTest, ProductWithInvalidOperands) {
+    EXPECT_THROW((void) Matrix(3, 4, 5).product(Matrix(3, 4, 5)), std::invalid_argument);
+    EXPECT_THROW((void) Matrix(3, 4, 5).product(Matrix(4, 3, 5), Matrix::Operand::Transposed), std::invalid_argument);
+    EXPECT_THROW((void) Matrix(3, 4, 5).product(Matrix(4, 3, 7)), std::invalid_argument);
+}
+
+/*********************** Reductions *************************/
+
+/**
+ * @test The reductions must match the naive computations, the large matrix being reduced by several threads
+ */
+TEST(MatrixTest, ReductionsAreValid) {
+    const unsigned MOD = 97;
+    // The random elements are in the first rows, the parallel ranges of the large matrix are not all zeros though
+    Matrix small(7, 13, MOD), large = Matrix::zeros(520, 256, MOD) + Matrix(60, 256, MOD);
+
+    Parallel::setThreadCount(4);
+    for (const Matrix *m: {&small, &large}) {
+        unsigned long long total = 0, trace = 0;
+        unsigned minimum = MOD, maximum = 0;
+        std::size_t zeros = 0;
+        std::vector<unsigned long long> rowSums(m->getRows()), columnSums(m->getColumns());
+        for (unsigned i = 0; i < m->getRows(); ++i) {
+            for (unsigned j = 0; j < m->getColumns(); ++j) {
+                const unsigned value = m->get(i, j);
+                total += value;
+                trace += i == j ? value : 0;
+                rowSums[i] += value;
+                columnSums[j] += value;
+                minimum = std::min(minimum, value);
+                maximum = std::max(maximum, value);
+                zeros += value == 0;
+            }
+        }
+
+        EXPECT_EQ(m->sum(), total % MOD);
+        EXPECT_EQ(m->trace(), trace % MOD);
+        EXPECT_EQ(m->min(), minimum);
+        EXPECT_EQ(m->max(), maximum);
+        EXPECT_EQ(m->count(0), zeros);
+        std::vector<unsigned> actualRowSums = m->rowSums(), actualColumnSums = m->columnSums();
+        for (unsigned i = 0; i < m->getRows(); ++i) {
+            EXPECT_EQ(actualRowSums[i], rowSums[i] % MOD);
+        }
+        for (unsigned j = 0; j < m->getColumns(); ++j) {
+            EXPECT_EQ(actualColumnSums[j], columnSums[j] % MOD);
+        }
+    }
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test The sum must stay exact with a modulo near 2^32, where the accumulator holds few elements before reducing
+ */
+TEST(MatrixTest, SumWithLargeModulo) {
+    const unsigned MOD = 4294967291u;
+    Matrix m(30, 30, MOD);
+    unsigned long long expected = 0;
+    for (unsigned i = 0; i < 30; ++i) {
+        for (unsigned j = 0; j < 30; ++j) {
+            expected = (expected + m.get(i, j)) % MOD;
+        }
+    }
+    EXPECT_EQ(m.sum(), expected);
+}
+
+/*********************** Fused operations *************************/
+
+/**
+ * @test The fused multiply-add gives the same result as the separate operations, with operands of different sizes
+ */
+TEST(MatrixTest, MultiplyAddMatchesSeparateOperations) {
+    const unsigned MOD = 251;
+    Matrix a(12, 20, MOD), b(12, 20, MOD), c(12, 20, MOD), small(5, 25, MOD);
+
+    EXPECT_EQ(getInnerData(a.multiplyAddStatic(b, c), 12, 20), getInnerData(a * b + c, 12, 20));
+    EXPECT_EQ(getInnerData(a.multiplyAddStatic(small, c), 12, 25), getInnerData(a * small + c, 12, 25));
+
+    Matrix expected = a * a + a;
+    a.multiplyAdd(a, a);
+    EXPECT_EQ(getInnerData(a, 12, 20), getInnerData(expected, 12, 20));
+}
+
+/**
+ * @test The fused multiply-add must stay exact with a modulo near 2^32, where a * b + c needs 64 bits
+ */
+TEST(MatrixTest, MultiplyAddWithLargeModulo) {
+    const unsigned long long MOD = 4294967291u;
+    Matrix a(6, 7, MOD), b(6, 7, MOD), c(6, 7, MOD);
+    Matrix result = a.multiplyAddStatic(b, c);
+    for (unsigned i = 0; i < 6; ++i) {
+        for (unsigned j = 0; j < 7; ++j) {
+            EXPECT_EQ(result.get(i, j), ((unsigned long long) a.get(i, j) * b.get(i, j) + c.get(i, j)) % MOD);
+        }
+    }
+}
+
+/**
+ * @test The scalar operations and axpy match their definition, with small and large modulo
+ */
+TEST(MatrixTest, ScalarOperationsAreValid) {
+    for (unsigned mod: {251u, 4294967291u}) {
+        const unsigned scalar = 4000000000u;
+        const unsigned long long k = scalar % mod;
+        Matrix x(9, 11, mod), y(9, 11, mod);
+        Matrix sum = y.addScalarStatic(scalar), product = y.multiplyScalarStatic(scalar), axpy = y.axpyStatic(scalar, x);
+
+        for (unsigned i = 0; i < 9; ++i) {
+            for (unsigned j = 0; j < 11; ++j) {
+                EXPECT_EQ(sum.get(i, j), (y.get(i, j) + k) % mod);
+                EXPECT_EQ(product.get(i, j), y.get(i, j) * k % mod);
+                EXPECT_EQ(axpy.get(i, j), (k * x.get(i, j) + y.get(i, j)) % mod);
+            }
+        }
+    }
+}
+
+/**
+ * @test The fused operations on a moved matrix or with a different modulo must throw an exception
+ */
+TEST(MatrixTest, FusedOperationsWithInvalidOperands) {
+    Matrix a(3, 3, 7), b(3, 3, 7);
+    EXPECT_THROW(a.axpy(2, Matrix(3, 3, 5)), std::invalid_argument);
+    EXPECT_THROW(a.multiplyAdd(b, Matrix(3, 3, 5)), std::invalid_argument);
+
+    Matrix moved(std::move(a));
+    EXPECT_THROW(a.multiplyScalar(3), std::runtime_error);
+    EXPECT_THROW(a.axpy(3, b), std::runtime_error);
+}
+
+/**
+ * Computes a power modulo n by repeated multiplications
+ * @param value The value
+ * @param exponent The power
+ * @param modulo The modulo
+ * @return value^exponent mod modulo
+ */
+unsigned naivePow(unsigned value, unsigned exponent, unsigned modulo) {
+    unsigned long long result = 1 % modulo;
+    for (unsigned e = 0; e < exponent; ++e) {
+        result = result * value % modulo;
+    }
+    return unsigned(result);
+}
+
+/**
+ * @test The element-wise power matches repeated multiplications, with odd (Montgomery) and even modulo
+ */
+TEST(MatrixTest, PowElementsIsValid) {
+    for (unsigned mod: {1u, 2u, 1000u, 1009u, 4294967291u, 4294967294u}) {
+        Matrix a(5, 13, mod);
+        for (unsigned exponent: {0u, 1u, 2u, 7u, 64u, 1000u}) {
+            Matrix result = a.powElementsStatic(exponent);
+            for (unsigned i = 0; i < 5; ++i) {
+                for (unsigned j = 0; j < 13; ++j) {
+                    EXPECT_EQ(result.get(i, j), naivePow(a.get(i, j), exponent, mod));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @test The element-wise power with a huge exponent must be correct (Fermat's little theorem) and not change copies
+ */
+TEST(MatrixTest, PowElementsWithLargeExponent) {
+    const unsigned MOD = 1000000007u;
+    Parallel::setThreadCount(3);
+    Matrix a = Matrix::zeros(300, 300, MOD) + Matrix(20, 20, MOD);
+    Matrix copy(a);
+    a.powElements(uint64_t(MOD - 1) * 1000000 + 3);
+    Parallel::setThreadCount(0);
+
+    for (unsigned i = 0; i < 20; ++i) {
+        for (unsigned j = 0; j < 20; ++j) {
+            EXPECT_EQ(a.get(i, j), naivePow(copy.get(i, j), 3, MOD));
+        }
+    }
+    EXPECT_EQ(a.get(299, 299), 0u);
+}
+
+/*********************** Matrix power *************************/
+
+/**
+ * @test The matrix power matches repeated products, for the small sizes raised on the stack and the larger ones
+ */
+TEST(MatrixTest, PowMatchesRepeatedProducts) {
+    for (unsigned size: {1u, 2u, 3u, 4u, 5u, 17u}) {
+        for (unsigned mod: {2u, 1009u, 4294967291u}) {
+            Matrix a(size, size, mod);
+            Matrix power = a;
+            for (unsigned exponent = 1; exponent <= 11; ++exponent) {
+                Matrix result = a.pow(exponent);
+                for (unsigned i = 0; i < size; ++i) {
+                    for (unsigned j = 0; j < size; ++j) {
+                        EXPECT_EQ(result.get(i, j), power.get(i, j)) << size << " " << mod << " " << exponent;
+                    }
+                }
+                power = power.product(a);
+            }
+        }
+    }
+}
+
+/**
+ * @test The power of the Fibonacci matrix gives the Fibonacci numbers, and A^(2k) = A^k * A^k for a huge k
+ */
+TEST(MatrixTest, PowWithLargeExponent) {
+    const unsigned MOD = 1000000007u;
+    Matrix fibonacci = SparseMatrix(2, 2, MOD, {{0, 0, 1}, {0, 1, 1}, {1, 0, 1}}).toDense();
+    unsigned long long previous = 0, current = 1;
+    for (unsigned k = 1; k < 90; ++k) {
+        std::swap(previous, current);
+        current += previous;
+    }
+    // F(90) and F(89)
+    Matrix result = fibonacci.pow(89);
+    EXPECT_EQ(result.get(0, 0), current % MOD);
+    EXPECT_EQ(result.get(0, 1), previous % MOD);
+
+    const uint64_t k = 1000000000000000000ull;
+    for (unsigned size: {3u, 40u}) {
+        Matrix a(size, size, MOD);
+        Matrix half = a.pow(k), square = half.product(half), full = a.pow(2 * k);
+        for (unsigned i = 0; i < size; ++i) {
+            for (unsigned j = 0; j < size; ++j) {
+                EXPECT_EQ(full.get(i, j), square.get(i, j));
+            }
+        }
+    }
+}
+
+/**
+ * @test The power 0 is the identity matrix, and a matrix which is not square cannot be raised to a power
+ */
+TEST(MatrixTest, PowZeroAndInvalidMatrix) {
+    for (unsigned size: {2u, 9u}) {
+        Matrix identity = Matrix(size, size, 13).pow(0);
+        for (unsigned i = 0; i < size; ++i) {
+            for (unsigned j = 0; j < size; ++j) {
+                EXPECT_EQ(identity.get(i, j), i == j ? 1u : 0u);
+            }
+        }
+    }
+    EXPECT_EQ(Matrix(5, 5, 1).pow(0).get(0, 0), 0u);
+    EXPECT_THROW((void) Matrix(3, 4, 13).pow(2), std::invalid_argument);
+}
+
+/*********************** Chain product *************************/
+
+/**
+ * @test The chain product gives the same result as the products from left to right, whatever the shapes
+ */
+TEST(MatrixTest, ChainProductMatchesSuccessiveProducts) {
+    for (unsigned mod: {1009u, 4294967291u}) {
+        Matrix a(30, 2, mod), b(2, 25, mod), c(25, 3, mod), d(3, 40, mod), e(40, 1, mod);
+        Matrix expected = a.product(b).product(c).product(d).product(e);
+        Matrix result = Matrix::chainProduct({a, b, c, d, e});
+
+        ASSERT_EQ(result.getRows(), 30u);
+        ASSERT_EQ(result.getColumns(), 1u);
+        for (unsigned i = 0; i < 30; ++i) {
+            EXPECT_EQ(result.get(i, 0), expected.get(i, 0));
+        }
+
+        // The same matrix can appear several times in the chain
+        Matrix square(6, 6, mod);
+        Matrix cube = Matrix::chainProduct({square, square, square});
+        Matrix power = square.pow(3);
+        for (unsigned i = 0; i < 6; ++i) {
+            for (unsigned j = 0; j < 6; ++j) {
+                EXPECT_EQ(cube.get(i, j), power.get(i, j));
+            }
+        }
+    }
+}
+
+/**
+ * @test The order of the chain product is the cheapest one, a single matrix is copied and a chain must be valid
+ */
+TEST(MatrixTest, ChainProductOrder) {
+    const unsigned MOD = 7;
+    Matrix a(50, 2, MOD), b(2, 50, MOD), c(50, 3, MOD);
+    const double leftFirst = Matrix::productCost(50, 2, 50, MOD) + Matrix::productCost(50, 50, 3, MOD);
+    const double rightFirst = Matrix::productCost(2, 50, 3, MOD) + Matrix::productCost(50, 2, 3, MOD);
+    EXPECT_LT(rightFirst, leftFirst);
+    EXPECT_DOUBLE_EQ(Matrix::chainCost({a, b, c}), rightFirst);
+
+    Matrix single = Matrix::chainProduct({a});
+    EXPECT_EQ(single.get(49, 1), a.get(49, 1));
+
+    EXPECT_THROW((void) Matrix::chainProduct({}), std::invalid_argument);
+    EXPECT_THROW((void) Matrix::chainProduct({a, c}), std::invalid_argument);
+    Matrix otherModulo(2, 3, 5);
+    EXPECT_THROW((void) Matrix::chainProduct({a, otherModulo}), std::invalid_argument);
+}
+
+/**
+ * @test A row vector is combined with each row and a column vector with each column, including for large moduli
+ */
+TEST(MatrixTest, BroadcastMatchesElements) {
+    for (unsigned modulo: {97u, 4294967291u}) {
+        const Matrix matrix(4, 6, modulo);
+        const Vector row(6, modulo), column(4, modulo);
+
+        Matrix sum = matrix.addBroadcastStatic(row, Matrix::Axis::Row);
+        Matrix difference = matrix.subBroadcastStatic(column, Matrix::Axis::Column);
+        Matrix scaledColumns = matrix.multiplyBroadcastStatic(row, Matrix::Axis::Row);
+        Matrix scaledRows = matrix.multiplyBroadcastStatic(column, Matrix::Axis::Column);
+        for (unsigned i = 0; i < 4; ++i) {
+            for (unsigned j = 0; j < 6; ++j) {
+                const unsigned value = matrix.get(i, j);
+                EXPECT_EQ(sum.get(i, j), Modular::add(value, row.get(j), modulo));
+                EXPECT_EQ(difference.get(i, j), Modular::sub(value, column.get(i), modulo));
+                EXPECT_EQ(scaledColumns.get(i, j), Modular::multiply(value, row.get(j), modulo));
+                EXPECT_EQ(scaledRows.get(i, j), Modular::multiply(value, column.get(i), modulo));
+            }
+        }
+
+        // In-place on a copy sharing the buffer, the original matrix is unchanged
+        Matrix copy(matrix);
+        copy.addBroadcast(row, Matrix::Axis::Row).subBroadcast(row, Matrix::Axis::Row);
+        for (unsigned j = 0; j < 6; ++j) {
+            EXPECT_EQ(copy.get(3, j), matrix.get(3, j));
+        }
+    }
+}
+
+/**
+ * @test The size and the modulo of the broadcast vector must match the matrix
+ */
+TEST(MatrixTest, BroadcastInvalidVector) {
+    Matrix matrix(3, 5, 7);
+    EXPECT_THROW(matrix.addBroadcast(Vector(3, 7), Matrix::Axis::Row), std::invalid_argument);
+    EXPECT_THROW(matrix.addBroadcast(Vector(5, 7), Matrix::Axis::Column), std::invalid_argument);
+    EXPECT_THROW(matrix.multiplyBroadcast(Vector(5, 11), Matrix::Axis::Row), std::invalid_argument);
+    EXPECT_NO_THROW(matrix.multiplyBroadcast(Vector(3, 7), Matrix::Axis::Column));
+}
+
+/**
+ * @test Equal matrices have the same hash, the remembered hash is dropped when the elements are written
+ */
+TEST(MatrixTest, EqualityAndHash) {
+    Matrix a(5, 7, 101);
+    Matrix shared(a);
+    Matrix privateCopy(a);
+    privateCopy.setCopyOnWrite(false);
+    Matrix cloned(privateCopy);
+    EXPECT_TRUE(a == shared);
+    EXPECT_TRUE(a == cloned);
+    EXPECT_EQ(a.hash(), shared.hash());
+    EXPECT_EQ(a.hash(), cloned.hash());
+
+    // Written in-place after its hash was remembered
+    cloned.addScalar(1);
+    EXPECT_TRUE(a != cloned);
+    EXPECT_NE(a.hash(), cloned.hash());
+    cloned.addScalar(100);
+    EXPECT_TRUE(a == cloned);
+    EXPECT_EQ(a.hash(), cloned.hash());
+
+    // Same elements, other shape or modulo
+    Matrix row = SparseMatrix(2, 3, 7, {{0, 1, 4}}).toDense(), column = SparseMatrix(3, 2, 7, {{0, 1, 4}}).toDense();
+    EXPECT_TRUE(row != column);
+    EXPECT_NE(row.hash(), column.hash());
+    EXPECT_TRUE(Matrix::zeros(2, 2, 7) != Matrix::zeros(2, 2, 11));
+    EXPECT_TRUE(Matrix::zeros(300, 300, 7) == Matrix::zeros(300, 300, 7));
+}
+
+/**
+ * @test The random matrices generated after seeding with the same seed are equal, until the seed is cleared
+ */
+TEST(MatrixTest, SeededMatricesRepeat) {
+    Utils::setSeed(42);
+    const Matrix first(7, 9, 1000);
+    Utils::setSeed(42);
+    const Matrix second(7, 9, 1000);
+    const Matrix third(7, 9, 1000);
+    EXPECT_TRUE(first == second);
+    EXPECT_FALSE(second == third);
+
+    // Once cleared, the seed no longer gives the same values, and the next tests draw unseeded ones
+    Utils::setSeed(42);
+    Utils::clearSeed();
+    const Matrix unseeded(7, 9, 1000);
+    EXPECT_FALSE(first == unseeded);
+}
+
+/**
+ * @test A seeded random matrix drawn by several threads is the one drawn by a single thread
+ */
+TEST(MatrixTest, SeededMatricesIndependentOfThreads) {
+    Tuning::setProfile({1, 1, 1, 0});
+    Utils::setSeed(7);
+    const Matrix single(130, 70, 1000);
+
+    Tuning::setProfile({4, 1, 1, 0});
+    Utils::setSeed(7);
+    const Matrix parallel(130, 70, 1000);
+    Utils::clearSeed();
+    Tuning::setProfile(Tuning::defaultProfile());
+
+    EXPECT_TRUE(single == parallel);
+    unsigned distinct = 0;
+    for (unsigned j = 1; j < 70; ++j) {
+        EXPECT_LT(single.get(129, j), 1000u);
+        distinct += single.get(129, j) != single.get(129, j - 1);
+    }
+    EXPECT_GT(distinct, 60u);
+}
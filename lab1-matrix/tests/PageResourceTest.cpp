@@ -0,0 +1,103 @@
+/**
+* @file PageResourceTest.cpp
+ * @brief This file is the test file for the PageResource class
+*/
+#include "gtest/gtest.h"
+#include "../src/Matrix/PageResource.hpp"
+#include "../src/Matrix/BufferPool.hpp"
+#include "../src/Matrix/Matrix.hpp"
+#include "../src/Utils/Parallel.h"
+#include "../src/Utils/Tuning.h"
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * Verifies that a matrix is the sum of two other matrices
+ * @param sum The sum
+ * @param lhs The first matrix
+ * @param rhs The second matrix, with the same size
+ * @return true if each element of sum is the sum of the elements of lhs and rhs, false otherwise
+ */
+bool isSum(const Matrix &sum, const Matrix &lhs, const Matrix &rhs) {
+    for (unsigned i = 0; i < lhs.getRows(); ++i) {
+        for (unsigned j = 0; j < lhs.getColumns(); ++j) {
+            if (sum.get(i, j) != (lhs.get(i, j) + rhs.get(i, j)) % lhs.getModulo()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Threshold low enough to map the buffers of small matrices in the tests
+const std::size_t TEST_THRESHOLD = 4096;
+
+/**
+ * @test Mapped matrices allocated with each policy must be usable, with a first touch from several pinned threads or
+ * with the pages faulted in by the allocating thread
+ */
+TEST(PageResourceTest, MappedMatricesWithEachPolicy) {
+    using HugePages = PageResource::HugePages;
+    // Small grains, so that the fill and the kernels split the rows over the 4 threads
+    Tuning::setProfile({4, 1, 1, 0});
+    for (HugePages hugePages: {HugePages::None, HugePages::Transparent, HugePages::Explicit}) {
+        for (bool interleave: {false, true}) {
+            for (bool firstTouch: {false, true}) {
+                Parallel::setPinning(firstTouch);
+                PageResource resource({hugePages, interleave, firstTouch, TEST_THRESHOLD});
+                Matrix lhs(60, 50, 23, &resource), rhs(60, 50, 23, &resource);
+                Matrix sum = lhs + rhs;
+
+                EXPECT_EQ(sum.getResource(), &resource);
+                EXPECT_TRUE(isSum(sum, lhs, rhs));
+            }
+        }
+    }
+    Parallel::setPinning(false);
+    Tuning::setProfile(Tuning::defaultProfile());
+}
+
+#ifdef __linux__
+/**
+ * @test A pinned parallel loop gives each chunk its CPU and gives the calling thread its CPUs back
+ */
+TEST(PageResourceTest, PinnedLoopRestoresCaller) {
+    cpu_set_t before, after;
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(before), &before), 0);
+
+    Parallel::setThreadCount(3);
+    Parallel::setPinning(true);
+    std::vector<int> cpus(3, -1);
+    Parallel::forRange(0, 3, 1, [&cpus](std::size_t first, std::size_t) { cpus[first] = sched_getcpu(); });
+    Parallel::setPinning(false);
+    Parallel::setThreadCount(0);
+
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(after), &after), 0);
+    EXPECT_TRUE(CPU_EQUAL(&before, &after));
+    for (std::size_t chunk = 0; chunk < cpus.size(); ++chunk) {
+        EXPECT_TRUE(CPU_ISSET(std::size_t(cpus[chunk]), &before)) << "chunk " << chunk;
+    }
+    if (CPU_COUNT(&before) >= 3) {
+        EXPECT_NE(cpus[0], cpus[1]);
+        EXPECT_NE(cpus[1], cpus[2]);
+    }
+}
+#endif
+
+/**
+ * @test The buffers smaller than the threshold must be given by the upstream resource
+ */
+TEST(PageResourceTest, SmallBuffersUseUpstream) {
+    BufferPool upstream;
+    PageResource resource({PageResource::HugePages::None, false, true, TEST_THRESHOLD}, &upstream);
+
+    Matrix small(10, 10, 7, &resource);
+    EXPECT_EQ(upstream.getStats().misses, 1);
+
+    Matrix large(40, 40, 7, &resource);
+    EXPECT_EQ(upstream.getStats().misses, PageResource::isSupported() ? 1 : 2);
+}
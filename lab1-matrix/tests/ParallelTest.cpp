@@ -0,0 +1,98 @@
+/**
+* @file ParallelTest.cpp
+ * @brief This file is the test file for the Parallel class
+*/
+#include "gtest/gtest.h"
+#include "../src/Utils/Parallel.h"
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @test The chunks of a loop cover each index of the range exactly once
+ */
+TEST(ParallelTest, ChunksCoverRange) {
+    Parallel::setThreadCount(4);
+    std::vector<int> counts(1003, 0);
+    Parallel::forRange(0, counts.size(), 1, [&counts](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            ++counts[i];
+        }
+    });
+    Parallel::setThreadCount(0);
+
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        EXPECT_EQ(counts[i], 1) << "index " << i;
+    }
+}
+
+/**
+ * @test Successive loops run on the same threads of the pool instead of starting new ones
+ */
+TEST(ParallelTest, LoopsReuseThreads) {
+    Parallel::setThreadCount(4);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    for (int loop = 0; loop < 50; ++loop) {
+        Parallel::forRange(0, 4, 1, [&](std::size_t, std::size_t) {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        });
+    }
+    Parallel::setThreadCount(0);
+
+    // The calling thread and the pool, which never has more threads than the largest loop has chunks
+    EXPECT_LE(threads.size(), 4u);
+}
+
+/**
+ * @test A loop started from a chunk, or from a Sequential thread, runs on its calling thread
+ */
+TEST(ParallelTest, NestedLoopsRunInline) {
+    Parallel::setThreadCount(4);
+    std::mutex mutex;
+    bool sameThread = true;
+    Parallel::forRange(0, 4, 1, [&](std::size_t, std::size_t) {
+        const std::thread::id outer = std::this_thread::get_id();
+        Parallel::forRange(0, 100, 1, [&](std::size_t first, std::size_t last) {
+            std::lock_guard<std::mutex> lock(mutex);
+            sameThread = sameThread && std::this_thread::get_id() == outer && first == 0 && last == 100;
+        });
+    });
+    EXPECT_TRUE(sameThread);
+
+    {
+        Parallel::Sequential sequential;
+        std::size_t calls = 0;
+        Parallel::forRange(0, 100, 1, [&calls](std::size_t, std::size_t) { ++calls; });
+        EXPECT_EQ(calls, 1u);
+    }
+    Parallel::setThreadCount(0);
+}
+
+/**
+ * @test An exception thrown by a chunk is rethrown once all the chunks are done, and the pool stays usable
+ */
+TEST(ParallelTest, ExceptionIsRethrownAfterAllChunks) {
+    Parallel::setThreadCount(4);
+    std::mutex mutex;
+    std::size_t done = 0;
+    EXPECT_THROW(Parallel::forRange(0, 4, 1, [&](std::size_t first, std::size_t) {
+        if (first == 2) {
+            throw std::runtime_error("failure");
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        ++done;
+    }), std::runtime_error);
+    EXPECT_EQ(done, 3u);
+
+    std::size_t calls = 0;
+    Parallel::forRange(0, 4, 1, [&](std::size_t, std::size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 4u);
+    Parallel::setThreadCount(0);
+}
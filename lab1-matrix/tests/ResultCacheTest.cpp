@@ -0,0 +1,76 @@
+/**
+* @file ResultCacheTest.cpp
+ * @brief This file is the test file for the ResultCache class
+*/
+#include "gtest/gtest.h"
+#include "../src/ResultCache/ResultCache.hpp"
+
+/**
+ * @test A repeated operation on equal operands returns the cached result, a changed operand computes it again
+ */
+TEST(ResultCacheTest, RepeatedOperationsHit) {
+    ResultCache cache(4);
+    Matrix a(6, 4, 97), b(4, 5, 97), c(6, 4, 97);
+
+    Matrix product = cache.apply(ResultCache::Operation::Product, a, b);
+    EXPECT_TRUE(product == a.product(b));
+    EXPECT_TRUE(cache.apply(ResultCache::Operation::Product, a, b) == product);
+    EXPECT_EQ(cache.getMisses(), 1u);
+    EXPECT_EQ(cache.getHits(), 1u);
+
+    // Equal operands with their own buffers
+    Matrix privateA(a);
+    privateA.setCopyOnWrite(false);
+    Matrix otherA(privateA);
+    EXPECT_TRUE(cache.apply(ResultCache::Operation::Product, otherA, b) == product);
+    EXPECT_EQ(cache.getHits(), 2u);
+
+    // The other operations are cached separately
+    EXPECT_TRUE(cache.apply(ResultCache::Operation::Add, a, c) == a + c);
+    EXPECT_TRUE(cache.apply(ResultCache::Operation::Sub, a, c) == a - c);
+    EXPECT_TRUE(cache.apply(ResultCache::Operation::Multiply, a, c) == a * c);
+    EXPECT_EQ(cache.getMisses(), 4u);
+
+    a.addScalar(1);
+    EXPECT_TRUE(cache.apply(ResultCache::Operation::Product, a, b) == a.product(b));
+    EXPECT_EQ(cache.getMisses(), 5u);
+    EXPECT_EQ(cache.size(), 4u);
+}
+
+/**
+ * @test The least recently used result is evicted first
+ */
+TEST(ResultCacheTest, EvictsLeastRecentlyUsed) {
+    ResultCache cache(2);
+    const Matrix a(3, 3, 11), b(3, 3, 11), c(3, 3, 11);
+
+    (void) cache.apply(ResultCache::Operation::Add, a, b);
+    (void) cache.apply(ResultCache::Operation::Add, a, c);
+    (void) cache.apply(ResultCache::Operation::Add, a, b);
+    (void) cache.apply(ResultCache::Operation::Add, b, c);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.getHits(), 1u);
+
+    (void) cache.apply(ResultCache::Operation::Add, a, b);
+    EXPECT_EQ(cache.getHits(), 2u);
+    (void) cache.apply(ResultCache::Operation::Add, a, c);
+    EXPECT_EQ(cache.getHits(), 2u);
+    EXPECT_EQ(cache.getMisses(), 4u);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+/**
+ * @test The capacity must be positive and a failed operation is not cached
+ */
+TEST(ResultCacheTest, InvalidOperations) {
+    EXPECT_THROW(ResultCache(0), std::invalid_argument);
+
+    ResultCache cache(2);
+    EXPECT_THROW((void) cache.apply(ResultCache::Operation::Product, Matrix(2, 3, 7), Matrix(2, 3, 7)),
+                 std::invalid_argument);
+    EXPECT_THROW((void) cache.apply(ResultCache::Operation::Add, Matrix(2, 3, 7), Matrix(2, 3, 5)),
+                 std::invalid_argument);
+    EXPECT_EQ(cache.size(), 0u);
+}
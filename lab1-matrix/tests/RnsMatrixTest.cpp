@@ -0,0 +1,101 @@
+/**
+* @file RnsMatrixTest.cpp
+ * @brief This file is the test file for the RnsMatrix and BigUnsigned classes
+*/
+#include "gtest/gtest.h"
+#include "../src/RnsMatrix/RnsMatrix.hpp"
+#include "../src/SparseMatrix/SparseMatrix.hpp"
+#include <sstream>
+
+/**
+ * @test The big numbers must be printed in base 10, including the groups of 9 digits with leading zeros
+ */
+TEST(RnsMatrixTest, BigUnsignedToString) {
+    EXPECT_EQ(BigUnsigned().toString(), "0");
+    EXPECT_EQ(BigUnsigned(1000000000).toString(), "1000000000");
+    EXPECT_EQ(BigUnsigned(1000000000000000001ull).toString(), "1000000000000000001");
+
+    // 2^64 = 2^32 * 2^32
+    BigUnsigned value(4294967296ull);
+    value.multiplyAdd(65536, 0).multiplyAdd(65536, 0);
+    EXPECT_EQ(value.toString(), "18446744073709551616");
+    EXPECT_EQ(value.divide(65536), 0u);
+    EXPECT_EQ(value, BigUnsigned(281474976710656ull));
+}
+
+/**
+ * @test The elements of a matrix must be reconstructed exactly from their residues
+ */
+TEST(RnsMatrixTest, RoundTrip) {
+    Matrix values(7, 9, 4000000000u);
+    RnsMatrix rns(values, {65521, 65519, 65497});
+    ASSERT_EQ(rns.getChannelCount(), 3u);
+    for (unsigned i = 0; i < 7; ++i) {
+        for (unsigned j = 0; j < 9; ++j) {
+            EXPECT_EQ(rns.get(i, j), BigUnsigned(values.get(i, j)));
+        }
+    }
+    EXPECT_THROW((void) rns.get(7, 0), std::out_of_range);
+}
+
+/**
+ * @test The operations match the arithmetic modulo the product of the primes, computed with 64 bits integers
+ */
+TEST(RnsMatrixTest, OperationsMatchModulus) {
+    const unsigned long long M = 65521ull * 65519;
+    RnsMatrix a(6, 8, {65521, 65519}), b(8, 5, {65521, 65519}), c(6, 8, {65521, 65519});
+    auto value = [](const RnsMatrix &m, unsigned i, unsigned j) { return std::stoull(m.get(i, j).toString()); };
+
+    RnsMatrix sum = a + c, difference = a - c, hadamard = a * c, product = a.product(b);
+    for (unsigned i = 0; i < 6; ++i) {
+        for (unsigned j = 0; j < 8; ++j) {
+            const unsigned long long x = value(a, i, j), y = value(c, i, j);
+            EXPECT_EQ(value(sum, i, j), (x + y) % M);
+            EXPECT_EQ(value(difference, i, j), (x + M - y) % M);
+            EXPECT_EQ(value(hadamard, i, j), x * y % M);
+        }
+        for (unsigned j = 0; j < 5; ++j) {
+            unsigned long long expected = 0;
+            for (unsigned k = 0; k < 8; ++k) {
+                expected = (expected + value(a, i, k) * value(b, k, j) % M) % M;
+            }
+            EXPECT_EQ(value(product, i, j), expected);
+        }
+    }
+}
+
+/**
+ * @test A modulus beyond 64 bits: (M - 1)^2 = 1 and M - 1 is printed in full
+ */
+TEST(RnsMatrixTest, ModulusBeyond64Bits) {
+    const std::vector<unsigned> primes{1000000007, 1000000009, 998244353};
+    std::vector<Matrix> channels;
+    for (unsigned prime: primes) {
+        channels.push_back(SparseMatrix(1, 2, prime, {{0, 0, prime - 1}, {0, 1, 1}}).toDense());
+    }
+    RnsMatrix minusOne(channels);
+    EXPECT_EQ(minusOne.getModulus().toString(), "998244368971909710889394239");
+    EXPECT_EQ(minusOne.get(0, 0).toString(), "998244368971909710889394238");
+
+    RnsMatrix square = minusOne * minusOne;
+    EXPECT_EQ(square.get(0, 0), BigUnsigned(1));
+
+    std::stringstream stream;
+    stream << square;
+    EXPECT_EQ(stream.str(), "1 1 \n");
+}
+
+/**
+ * @test The primes must be distinct primes and the operands must have the same primes
+ */
+TEST(RnsMatrixTest, InvalidModuli) {
+    EXPECT_THROW(RnsMatrix(2, 2, {}), std::invalid_argument);
+    EXPECT_THROW(RnsMatrix(2, 2, {7, 9}), std::invalid_argument);
+    EXPECT_THROW(RnsMatrix(2, 2, {7, 7}), std::invalid_argument);
+    EXPECT_THROW(RnsMatrix({Matrix(2, 2, 7), Matrix(2, 3, 11)}), std::invalid_argument);
+
+    RnsMatrix a(2, 2, {7, 11});
+    EXPECT_THROW(a.add(RnsMatrix(2, 2, {7, 13})), std::invalid_argument);
+    EXPECT_THROW(a.add(RnsMatrix(2, 2, {7})), std::invalid_argument);
+    EXPECT_THROW((void) a.product(RnsMatrix(3, 2, {7, 11})), std::invalid_argument);
+}
@@ -0,0 +1,196 @@
+/**
+* @file SparseMatrixTest.cpp
+ * @brief This file is the test file for the SparseMatrix class
+*/
+#include "gtest/gtest.h"
+#include "../src/SparseMatrix/SparseMatrix.hpp"
+#include <sstream>
+
+/**
+ * @brief Creates a sparse matrix with one element out of 4 set on a diagonal pattern.
+ * @param rows The number of rows.
+ * @param cols The number of columns.
+ * @param mod The modulo.
+ * @return The sparse matrix.
+ */
+SparseMatrix makeSparse(unsigned rows, unsigned cols, unsigned mod) {
+    std::vector<SparseMatrix::Entry> entries;
+    for (unsigned i = 0; i < rows; ++i) {
+        for (unsigned j = (i % 4); j < cols; j += 4) {
+            entries.push_back({i, j, i * cols + j + 1});
+        }
+    }
+    return {rows, cols, mod, entries};
+}
+
+/**
+ * Verifies that a sparse and a dense matrix hold the same elements
+ * @param sparse The sparse matrix
+ * @param dense The dense matrix
+ * @return true if both matrices have the same size and elements, false otherwise
+ */
+bool isSameMatrix(const SparseMatrix &sparse, const Matrix &dense) {
+    if (sparse.getRows() != dense.getRows() || sparse.getColumns() != dense.getColumns()) {
+        return false;
+    }
+    for (unsigned i = 0; i < dense.getRows(); ++i) {
+        for (unsigned j = 0; j < dense.getColumns(); ++j) {
+            if (sparse.get(i, j) != dense.get(i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/*********************** Constructors and conversions *************************/
+
+/**
+ * @test The entries are reduced modulo n, the duplicates are summed and the zeros are not stored
+ */
+TEST(SparseMatrixTest, EntriesConstructorValid) {
+    SparseMatrix m(3, 4, 5, {{2, 3, 7}, {0, 1, 3}, {0, 1, 4}, {1, 2, 10}});
+
+    EXPECT_EQ(m.nonZeros(), 2);
+    EXPECT_EQ(m.get(0, 1), 2);
+    EXPECT_EQ(m.get(2, 3), 2);
+    EXPECT_EQ(m.get(1, 2), 0);
+    EXPECT_EQ(m.get(0, 0), 0);
+}
+
+/**
+ * @test The constructors must throw the same exceptions as the dense matrix
+ */
+TEST(SparseMatrixTest, ConstructorInvalidArguments) {
+    EXPECT_THROW(SparseMatrix(3, 4, 0), std::invalid_argument);
+    EXPECT_THROW(SparseMatrix(0, 4, 1), std::runtime_error);
+    EXPECT_THROW(SparseMatrix(3, 0, 1), std::runtime_error);
+    EXPECT_THROW(SparseMatrix(3, 4, 5, {{3, 0, 1}}), std::out_of_range);
+}
+
+/**
+ * @test Converting a dense matrix to a sparse matrix and back must give the same elements
+ */
+TEST(SparseMatrixTest, DenseRoundTrip) {
+    Matrix dense(7, 5, 3);
+    SparseMatrix sparse(dense);
+    EXPECT_TRUE(isSameMatrix(sparse, dense));
+    EXPECT_TRUE(isSameMatrix(sparse, sparse.toDense()));
+}
+
+/**
+ * @test The stream operator prints the dense form of the matrix
+ */
+TEST(SparseMatrixTest, StreamOperatorPrintsDenseForm) {
+    SparseMatrix sparse = makeSparse(5, 6, 7);
+    std::stringstream sparseStream, denseStream;
+    sparseStream << sparse;
+    denseStream << sparse.toDense();
+    EXPECT_EQ(sparseStream.str(), denseStream.str());
+}
+
+/**
+ * @test The transpose swaps the indices of every element
+ */
+TEST(SparseMatrixTest, TransposeIsValid) {
+    SparseMatrix m = makeSparse(5, 9, 11);
+    SparseMatrix t = m.transpose();
+
+    ASSERT_EQ(t.getRows(), 9);
+    ASSERT_EQ(t.getColumns(), 5);
+    EXPECT_EQ(t.nonZeros(), m.nonZeros());
+    for (unsigned i = 0; i < 5; ++i) {
+        for (unsigned j = 0; j < 9; ++j) {
+            EXPECT_EQ(t.get(j, i), m.get(i, j));
+        }
+    }
+}
+
+/*********************** Operations *************************/
+
+/**
+ * @test Sparse with sparse operations must give the same result as the dense operations, including different sizes
+ */
+TEST(SparseMatrixTest, SparseSparseOperationsMatchDense) {
+    SparseMatrix a = makeSparse(6, 8, 13), b = makeSparse(9, 5, 13).transpose();
+
+    EXPECT_TRUE(isSameMatrix(a + b, a.toDense() + b.toDense()));
+    EXPECT_TRUE(isSameMatrix(a - b, a.toDense() - b.toDense()));
+    EXPECT_TRUE(isSameMatrix(a * b, a.toDense() * b.toDense()));
+}
+
+/**
+ * @test Sparse with dense operations must give the same result as the dense operations, including different sizes
+ */
+TEST(SparseMatrixTest, SparseDenseOperationsMatchDense) {
+    const unsigned MOD = 17;
+    SparseMatrix sparse = makeSparse(6, 8, MOD);
+    Matrix dense(8, 6, MOD);
+
+    EXPECT_TRUE(isSameMatrix(SparseMatrix(sparse + dense), sparse.toDense() + dense));
+    EXPECT_TRUE(isSameMatrix(SparseMatrix(dense + sparse), dense + sparse.toDense()));
+    EXPECT_TRUE(isSameMatrix(SparseMatrix(sparse - dense), sparse.toDense() - dense));
+    EXPECT_TRUE(isSameMatrix(SparseMatrix(dense - sparse), dense - sparse.toDense()));
+    EXPECT_TRUE(isSameMatrix(sparse * dense, sparse.toDense() * dense));
+    EXPECT_TRUE(isSameMatrix(dense * sparse, dense * sparse.toDense()));
+}
+
+/**
+ * @test A matrix must be able to subtract itself and the result has no element stored
+ */
+TEST(SparseMatrixTest, SubtractItself) {
+    SparseMatrix m = makeSparse(4, 4, 7);
+    m.sub(m);
+    EXPECT_EQ(m.nonZeros(), 0);
+}
+
+/**
+ * @test Operations with different modulo must throw an exception
+ */
+TEST(SparseMatrixTest, OperationsWithDifferentModulo) {
+    SparseMatrix sparse = makeSparse(4, 5, 8);
+    EXPECT_THROW(sparse + makeSparse(4, 5, 9), std::invalid_argument);
+    EXPECT_THROW(sparse - Matrix(4, 5, 9), std::invalid_argument);
+    EXPECT_THROW(Matrix(4, 5, 9) * sparse, std::invalid_argument);
+}
+
+/**
+ * @test The matrix product with a dense matrix must match the definition of the product
+ */
+TEST(SparseMatrixTest, ProductIsValid) {
+    const unsigned ROWS = 5, INNER = 7, COLS = 3, MOD = 97;
+    SparseMatrix sparse = makeSparse(ROWS, INNER, MOD);
+    Matrix dense(INNER, COLS, MOD);
+    Matrix result = sparse.product(dense);
+
+    ASSERT_EQ(result.getRows(), ROWS);
+    ASSERT_EQ(result.getColumns(), COLS);
+    for (unsigned i = 0; i < ROWS; ++i) {
+        for (unsigned j = 0; j < COLS; ++j) {
+            unsigned long long expected = 0;
+            for (unsigned k = 0; k < INNER; ++k) {
+                expected += (unsigned long long) sparse.get(i, k) * dense.get(k, j);
+            }
+            EXPECT_EQ(result.get(i, j), expected % MOD);
+        }
+    }
+}
+
+/**
+ * @test The matrix product must stay exact when the reduction must be done at each product (modulo near 2^32)
+ */
+TEST(SparseMatrixTest, ProductWithLargeModulo) {
+    const unsigned MOD = 4294967291u;
+    SparseMatrix sparse(1, 3, MOD, {{0, 0, MOD - 1}, {0, 1, MOD - 1}, {0, 2, MOD - 1}});
+    Matrix ones = SparseMatrix(3, 1, MOD, {{0, 0, MOD - 1}, {1, 0, MOD - 1}, {2, 0, MOD - 1}}).toDense();
+
+    // (-1) * (-1) * 3 = 3
+    EXPECT_EQ(sparse.product(ones).get(0, 0), 3);
+}
+
+/**
+ * @test The matrix product with incompatible dimensions must throw an exception
+ */
+TEST(SparseMatrixTest, ProductWithInvalidDimensions) {
+    EXPECT_THROW(makeSparse(3, 4, 5).product(Matrix(3, 4, 5)), std::invalid_argument);
+}
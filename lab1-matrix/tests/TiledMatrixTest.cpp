@@ -0,0 +1,124 @@
+/**
+* @file TiledMatrixTest.cpp
+ * @brief This file is the test file for the TiledMatrix class
+*/
+#include "gtest/gtest.h"
+#include "../src/TiledMatrix/TiledMatrix.hpp"
+#include "../src/SparseMatrix/SparseMatrix.hpp"
+#include "../src/Utils/Parallel.h"
+#include <sstream>
+
+/**
+ * Verifies that a tiled matrix and a row-major matrix hold the same elements
+ * @param tiled The tiled matrix
+ * @param dense The row-major matrix
+ * @return true if both matrices have the same size and elements, false otherwise
+ */
+bool isSameMatrix(const TiledMatrix &tiled, const Matrix &dense) {
+    if (tiled.getRows() != dense.getRows() || tiled.getColumns() != dense.getColumns()) {
+        return false;
+    }
+    for (unsigned i = 0; i < dense.getRows(); ++i) {
+        for (unsigned j = 0; j < dense.getColumns(); ++j) {
+            if (tiled.get(i, j) != dense.get(i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @test Converting a matrix to the tiled layout and back must give the same elements, with partial tiles
+ */
+TEST(TiledMatrixTest, DenseRoundTrip) {
+    Matrix dense(70, 45, 13);
+    TiledMatrix tiled(dense);
+    EXPECT_TRUE(isSameMatrix(tiled, dense));
+    EXPECT_TRUE(isSameMatrix(tiled, tiled.toMatrix()));
+
+    std::stringstream tiledStream, denseStream;
+    tiledStream << tiled;
+    denseStream << dense;
+    EXPECT_EQ(tiledStream.str(), denseStream.str());
+}
+
+/**
+ * @test The constructor must throw the same exceptions as the row-major matrix
+ */
+TEST(TiledMatrixTest, ConstructorInvalidArguments) {
+    EXPECT_THROW(TiledMatrix(3, 4, 0), std::invalid_argument);
+    EXPECT_THROW(TiledMatrix(0, 4, 1), std::runtime_error);
+    EXPECT_THROW(TiledMatrix(3, 0, 1), std::runtime_error);
+    EXPECT_THROW((void) TiledMatrix(3, 4, 5).get(3, 0), std::out_of_range);
+}
+
+/**
+ * @test The operations must give the same result as the row-major operations, including different sizes
+ */
+TEST(TiledMatrixTest, OperationsMatchDense) {
+    Matrix a(40, 100, 17), b(75, 33, 17);
+    TiledMatrix tiledA(a), tiledB(b);
+
+    EXPECT_TRUE(isSameMatrix(tiledA + tiledB, a + b));
+    EXPECT_TRUE(isSameMatrix(tiledA - tiledB, a - b));
+    EXPECT_TRUE(isSameMatrix(tiledB - tiledA, b - a));
+    EXPECT_TRUE(isSameMatrix(tiledA * tiledB, a * b));
+    EXPECT_THROW(tiledA + TiledMatrix(2, 2, 5), std::invalid_argument);
+}
+
+/**
+ * @test A matrix must be able to subtract itself and the result is 0 for each element
+ */
+TEST(TiledMatrixTest, SubtractItself) {
+    TiledMatrix tiled(Matrix(50, 50, 7));
+    tiled.sub(tiled);
+    EXPECT_TRUE(isSameMatrix(tiled, Matrix::zeros(50, 50, 7)));
+}
+
+/**
+ * @test The tiled product must match the definition of the product, with partial tiles and several threads
+ */
+TEST(TiledMatrixTest, ProductIsValid) {
+    Parallel::setThreadCount(3);
+    const unsigned ROWS = 70, INNER = 45, COLS = 66, MOD = 1009;
+    Matrix a(ROWS, INNER, MOD), b(INNER, COLS, MOD);
+    TiledMatrix result = TiledMatrix(a).product(TiledMatrix(b));
+    Parallel::setThreadCount(0);
+
+    ASSERT_EQ(result.getRows(), ROWS);
+    ASSERT_EQ(result.getColumns(), COLS);
+    for (unsigned i = 0; i < ROWS; ++i) {
+        for (unsigned j = 0; j < COLS; ++j) {
+            unsigned long long expected = 0;
+            for (unsigned k = 0; k < INNER; ++k) {
+                expected += (unsigned long long) a.get(i, k) * b.get(k, j);
+            }
+            EXPECT_EQ(result.get(i, j), expected % MOD);
+        }
+    }
+}
+
+/**
+ * @test The tiled product must stay exact when the reduction must be done at each product (modulo near 2^32)
+ */
+TEST(TiledMatrixTest, ProductWithLargeModulo) {
+    const unsigned MOD = 4294967291u, INNER = 40;
+    std::vector<SparseMatrix::Entry> rowEntries, columnEntries;
+    for (unsigned k = 0; k < INNER; ++k) {
+        rowEntries.push_back({0, k, MOD - 1});
+        columnEntries.push_back({k, 0, MOD - 1});
+    }
+    TiledMatrix row(SparseMatrix(1, INNER, MOD, rowEntries).toDense());
+    TiledMatrix column(SparseMatrix(INNER, 1, MOD, columnEntries).toDense());
+
+    // (-1) * (-1) * 40 = 40
+    EXPECT_EQ(row.product(column).get(0, 0), INNER);
+}
+
+/**
+ * @test The matrix product with incompatible dimensions must throw an exception
+ */
+TEST(TiledMatrixTest, ProductWithInvalidDimensions) {
+    EXPECT_THROW((void) TiledMatrix(3, 4, 5).product(TiledMatrix(3, 4, 5)), std::invalid_argument);
+}
@@ -0,0 +1,95 @@
+/**
+* @file TuningTest.cpp
+ * @brief This file is the test file for the Tuning class
+*/
+#include "gtest/gtest.h"
+#include "../src/Utils/Tuning.h"
+#include "../src/Matrix/Matrix.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Reads all the lines of a file.
+ */
+static std::vector<std::string> readTuningLines(const std::string &path) {
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/**
+ * @test A saved profile is loaded back for this CPU model, the profiles of the other models are kept
+ */
+TEST(TuningTest, SaveAndLoadProfile) {
+    const std::string path = ::testing::TempDir() + "labmatrix_tuning_test";
+    std::remove(path.c_str());
+    EXPECT_FALSE(Tuning::loadProfile(path));
+
+    std::ofstream(path) << "Another CPU\t3 5 7 9\n";
+    EXPECT_FALSE(Tuning::loadProfile(path));
+
+    // The same model with another number of hardware threads is another machine
+    std::ofstream(path) << Tuning::cpuModel() << " x0\t3 5 7 9\n";
+    EXPECT_FALSE(Tuning::loadProfile(path));
+    std::ofstream(path) << "Another CPU\t3 5 7 9\n";
+
+    Tuning::saveProfile(path, {1, 1000, 2000, 64});
+    Tuning::saveProfile(path, {1, 4000, 8000, 256});
+    const std::vector<std::string> lines = readTuningLines(path);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "Another CPU\t3 5 7 9");
+    EXPECT_EQ(lines[1], Tuning::profileKey() + "\t1 4000 8000 256");
+
+    ASSERT_TRUE(Tuning::loadProfile(path));
+    const Tuning::Profile profile = Tuning::getProfile();
+    EXPECT_EQ(profile.threadCount, 1u);
+    EXPECT_EQ(profile.elementGrain, 4000u);
+    EXPECT_EQ(profile.productGrain, 8000u);
+    EXPECT_EQ(profile.productBlock, 256u);
+
+    Tuning::setProfile(Tuning::defaultProfile());
+    std::remove(path.c_str());
+}
+
+/**
+ * @test The product gives the same result whatever the block of columns and the grains
+ */
+TEST(TuningTest, BlockedProductMatchesUnblocked) {
+    const Matrix a(20, 50, 4294967291u), b(50, 150, 4294967291u);
+    const Matrix expected = a.product(b);
+
+    for (unsigned block: {7u, 64u, 150u, 1000u}) {
+        Tuning::setProfile({0, 1, 1, block});
+        const Matrix result = a.product(b);
+        for (unsigned i = 0; i < 20; ++i) {
+            for (unsigned j = 0; j < 150; ++j) {
+                ASSERT_EQ(result.get(i, j), expected.get(i, j)) << "block " << block;
+            }
+        }
+    }
+    Tuning::setProfile(Tuning::defaultProfile());
+}
+
+/**
+ * @test The autotuner picks candidate values and uses them
+ */
+TEST(TuningTest, AutotuneUsesProfile) {
+    const Tuning::Profile profile = Tuning::autotune();
+    const Tuning::Profile current = Tuning::getProfile();
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    // All the hardware threads are saved as 0, not as their number on this machine
+    EXPECT_LT(profile.threadCount, hardware);
+    EXPECT_EQ(current.threadCount, profile.threadCount == 0 ? hardware : profile.threadCount);
+    EXPECT_EQ(current.elementGrain, profile.elementGrain);
+    EXPECT_EQ(current.productGrain, profile.productGrain);
+    EXPECT_EQ(current.productBlock, profile.productBlock);
+    EXPECT_TRUE(profile.productBlock == 0 || profile.productBlock >= 64);
+
+    Tuning::setProfile(Tuning::defaultProfile());
+}
@@ -0,0 +1,95 @@
+/**
+* @file VectorTest.cpp
+ * @brief This file is the test file for the Vector class and the matrix-vector products
+*/
+#include "gtest/gtest.h"
+#include "../src/Vector/Vector.hpp"
+#include "../src/Matrix/Matrix.hpp"
+#include "../src/Utils/Modular.h"
+#include <sstream>
+
+/**
+ * @brief Computes the product of a matrix with a vector element by element.
+ */
+static std::vector<unsigned> naiveMatrixVector(const Matrix &matrix, const Vector &vector) {
+    const unsigned n = matrix.getModulo();
+    std::vector<unsigned> result(matrix.getRows(), 0);
+    for (unsigned i = 0; i < matrix.getRows(); ++i) {
+        for (unsigned k = 0; k < matrix.getColumns(); ++k) {
+            result[i] = Modular::add(result[i], Modular::multiply(matrix.get(i, k), vector.get(k), n), n);
+        }
+    }
+    return result;
+}
+
+/**
+ * @test The elements are reduced, and the operations pad the shorter vector with zeros
+ */
+TEST(VectorTest, ElementsAndOperations) {
+    Vector a({3, 12, 5}, 7), b({6, 1, 2, 4}, 7);
+    EXPECT_EQ(a.getSize(), 3u);
+    EXPECT_EQ(a.get(1), 5u);
+    a.set(2, 9);
+    EXPECT_EQ(a.get(2), 2u);
+    EXPECT_THROW((void) a.get(3), std::out_of_range);
+    EXPECT_THROW(a.set(3, 0), std::out_of_range);
+
+    std::stringstream stream;
+    stream << a + b << b - a;
+    EXPECT_EQ(stream.str(), "2 6 4 4 \n3 3 0 4 \n");
+
+    // 3 * 6 + 5 * 1 + 2 * 2 = 27
+    EXPECT_EQ(a.dot(b), 6u);
+    EXPECT_EQ(Vector::zeros(5, 7).dot(b), 0u);
+}
+
+/**
+ * @test The matrix-vector product matches the sum of the products, including with a modulo close to 2^32
+ */
+TEST(VectorTest, ProductMatchesNaive) {
+    for (unsigned modulo: {97u, 3000000019u, 4294967291u}) {
+        Matrix matrix(9, 301, modulo);
+        Vector vector(301, modulo);
+        Vector result = matrix.product(vector);
+        ASSERT_EQ(result.getSize(), 9u);
+
+        const std::vector<unsigned> expected = naiveMatrixVector(matrix, vector);
+        for (unsigned i = 0; i < 9; ++i) {
+            EXPECT_EQ(result.get(i), expected[i]) << "modulo " << modulo << ", row " << i;
+        }
+    }
+}
+
+/**
+ * @test The batched product gives the same vectors as the products with each vector
+ */
+TEST(VectorTest, BatchedProduct) {
+    const unsigned modulo = 4294967291u;
+    Matrix matrix(13, 21, modulo);
+    const std::vector<Vector> vectors{Vector(21, modulo), Vector(21, modulo), Vector(21, modulo)};
+
+    std::vector<Vector> results = matrix.product(vectors);
+    ASSERT_EQ(results.size(), 3u);
+    for (std::size_t v = 0; v < vectors.size(); ++v) {
+        const std::vector<unsigned> expected = naiveMatrixVector(matrix, vectors[v]);
+        for (unsigned i = 0; i < 13; ++i) {
+            EXPECT_EQ(results[v].get(i), expected[i]);
+        }
+    }
+    EXPECT_TRUE(matrix.product(std::vector<Vector>{}).empty());
+}
+
+/**
+ * @test The arguments and the operands must be valid
+ */
+TEST(VectorTest, InvalidArguments) {
+    EXPECT_THROW(Vector(3, 0), std::invalid_argument);
+    EXPECT_THROW(Vector(0, 7), std::runtime_error);
+    EXPECT_THROW(Vector(std::vector<unsigned>{}, 7), std::runtime_error);
+    EXPECT_THROW((void) Vector(3, 7).addStatic(Vector(3, 11)), std::invalid_argument);
+
+    Matrix matrix(3, 4, 7);
+    EXPECT_THROW((void) matrix.product(Vector(3, 7)), std::invalid_argument);
+    EXPECT_THROW((void) matrix.product(Vector(4, 11)), std::invalid_argument);
+    EXPECT_THROW((void) matrix.product(std::vector<Vector>{Vector(4, 7), Vector(5, 7)}), std::invalid_argument);
+}